@@ -0,0 +1,44 @@
+
+#pragma once
+
+#include "YAKL.h"
+
+// Sum N quantities over the horizontal CRM columns, for each (k,icrm), without atomics.
+// This is shared by the samxx and PAM CRMs.
+//
+//   f    (k,j,i,icrm,vals)  : sets vals(0:N-1) to the contributions of column (j,i) at level k
+//   store(k,icrm,sums)      : receives the sums over all (j,i) of vals, for level k
+//
+// The reduction is done in two stages: one thread per (k,j,icrm) sums its row over x
+// into a temporary array, then one thread per (k,icrm) sums the rows over y and calls
+// store. Compared to atomically adding each (k,j,i,icrm) point into the few outputs,
+// this avoids the serialization of the atomics, and gives reproducible results.
+// For 0D (surface) quantities, simply call this with nz=1 and ignore k.
+// f is called exactly once for each (k,j,i,icrm), so it may also store per-point results
+// (e.g., perturbations from a mean), fusing their computation with the sum.
+template <class T, int N, class F, class G>
+inline void crm_horizontal_sum( int nz, int ny, int nx, int ncrms, F const &f, G const &store ) {
+  using yakl::c::parallel_for;
+  using yakl::c::SimpleBounds;
+  yakl::Array<T,4,yakl::memDevice,yakl::styleC> row_sums("crm_hsum_row_sums",N,nz,ny,ncrms);
+  // stage 1: sum over x
+  parallel_for( "crm_horizontal_sum_x" , SimpleBounds<3>(nz,ny,ncrms) , YAKL_LAMBDA (int k, int j, int icrm) {
+    yakl::SArray<T,1,N> vals;
+    yakl::SArray<T,1,N> sums;
+    for (int l=0; l<N; l++) { sums(l) = 0; }
+    for (int i=0; i<nx; i++) {
+      f(k,j,i,icrm,vals);
+      for (int l=0; l<N; l++) { sums(l) += vals(l); }
+    }
+    for (int l=0; l<N; l++) { row_sums(l,k,j,icrm) = sums(l); }
+  });
+  // stage 2: sum over y
+  parallel_for( "crm_horizontal_sum_y" , SimpleBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+    yakl::SArray<T,1,N> sums;
+    for (int l=0; l<N; l++) { sums(l) = 0; }
+    for (int j=0; j<ny; j++) {
+      for (int l=0; l<N; l++) { sums(l) += row_sums(l,k,j,icrm); }
+    }
+    store(k,icrm,sums);
+  });
+}
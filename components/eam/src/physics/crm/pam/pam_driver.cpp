@@ -26,7 +26,53 @@
 bool constexpr enable_check_state = false;
 
 
-inline int pam_driver_set_subcycle_timestep( pam::PamCoupler &coupler, real crm_dt_fixed ) {
+// Driver data that persists across calls to pam_driver(), so that it is only
+// allocated/initialized when needed, rather than at every GCM physics step
+// (or at every CRM step). Note that the coupler itself cannot persist, since
+// it mirrors the GCM chunk data, which is re-registered at every call.
+struct PamDriverContext {
+  bool p3_tables_loaded = false;
+  int  nens     = -1;
+  int  crm_nz   = -1;
+  int  gcm_nlev = -1;
+  real2d wvel_max;    // work arrays for the CFL calculation
+  real2d uvel_max;
+  real2d cfl_max;
+  real2d input_zint;  // device copy of GCM interface heights for current call
+
+  // (re)allocate work arrays if the dimensions changed (e.g., the last chunk may have fewer columns)
+  void update_dims( int crm_nz_in , int gcm_nlev_in , int nens_in ) {
+    if (crm_nz_in==crm_nz && gcm_nlev_in==gcm_nlev && nens_in==nens) { return; }
+    crm_nz   = crm_nz_in;
+    gcm_nlev = gcm_nlev_in;
+    nens     = nens_in;
+    wvel_max   = real2d("wvel_max",  crm_nz,nens);
+    uvel_max   = real2d("uvel_max",  crm_nz,nens);
+    cfl_max    = real2d("cfl_max",   crm_nz,nens);
+    input_zint = real2d("input_zint",gcm_nlev+1,nens);
+  }
+
+  // release the work arrays, which must happen before YAKL is finalized
+  // (the context is static, so its destructor would run too late)
+  void finalize() {
+    p3_tables_loaded = false;
+    nens     = -1;
+    crm_nz   = -1;
+    gcm_nlev = -1;
+    wvel_max   = real2d();
+    uvel_max   = real2d();
+    cfl_max    = real2d();
+    input_zint = real2d();
+  }
+};
+
+inline PamDriverContext &get_pam_driver_context() {
+  static PamDriverContext ctx;
+  return ctx;
+}
+
+
+inline int pam_driver_set_subcycle_timestep( pam::PamCoupler &coupler, PamDriverContext &ctx, real crm_dt_fixed ) {
   // calculate the CFL condition and adjust the PAM time loop subcylcing
   //------------------------------------------------------------------------------------------------
   using yakl::c::parallel_for;
@@ -41,18 +87,16 @@ inline int pam_driver_set_subcycle_timestep( pam::PamCoupler &coupler, real crm_
   auto crm_dx        = coupler.get_option<real>("crm_dx");
   auto crm_dy        = coupler.get_option<real>("crm_dy");
   auto &dm_device = coupler.get_data_manager_device_readonly();
-  auto &dm_host   = coupler.get_data_manager_host_readonly();
   auto uvel       = dm_device.get<real const,4>("uvel");
   auto wvel       = dm_device.get<real const,4>("wvel");
-  auto input_zint = dm_host.get<real const,2>("input_zint").createDeviceCopy();
+  auto input_zint = ctx.input_zint;
   //------------------------------------------------------------------------------------------------
-  yakl::ParallelMax<real,yakl::memDevice> pmax( crm_nz*nens );
   real cfl = 0;
   int num_subcycle = 1;
   int constexpr max_num_subcycle = 10;
-  real2d wvel_max("wvel_max",crm_nz,nens);
-  real2d uvel_max("uvel_max",crm_nz,nens);
-  real2d cfl_max("cfl_max",  crm_nz,nens);
+  auto wvel_max = ctx.wvel_max;
+  auto uvel_max = ctx.uvel_max;
+  auto cfl_max  = ctx.cfl_max;
   //------------------------------------------------------------------------------------------------
   // initialize max U and W arrays
   parallel_for( SimpleBounds<2>(crm_nz,nens) , YAKL_LAMBDA (int k, int n) {
@@ -81,6 +125,7 @@ inline int pam_driver_set_subcycle_timestep( pam::PamCoupler &coupler, real crm_
   coupler.set_option<real>("crm_dt",crm_dt_subcycle);
   // check for excessive subcylcing - don't exit, just print
   if(num_subcycle > max_num_subcycle) {
+    yakl::ParallelMax<real,yakl::memDevice> pmax( crm_nz*nens );
     real umax = pmax(uvel_max.data());
     real wmax = pmax(wvel_max.data());
     printf("PAM_DRIVER - WARNING: excessive subcycling!"
@@ -140,6 +185,11 @@ extern "C" void pam_driver() {
   auto &dm_device = coupler.get_data_manager_device_readwrite();
   auto &dm_host   = coupler.get_data_manager_host_readwrite();
   //------------------------------------------------------------------------------------------------
+  // update persistent driver data, and copy the GCM interface heights to device once per call
+  auto &ctx = get_pam_driver_context();
+  ctx.update_dims( crm_nz , gcm_nlev , nens );
+  dm_host.get<real const,2>("input_zint").deep_copy_to(ctx.input_zint);
+  //------------------------------------------------------------------------------------------------
   // Create objects for dycor, microphysics, and turbulence and initialize them
   bool verbose = is_first_step || is_restart;
   Microphysics micro;
@@ -199,12 +249,13 @@ extern "C" void pam_driver() {
     modules::perturb_temperature( coupler , global_column_id );
   }
 
-  // Microphysics initialization - load lookup tables
+  // Microphysics initialization - load lookup tables once per run
   #if defined(P3_CXX)
-    if (is_first_step || is_restart) {
+    if (!ctx.p3_tables_loaded) {
       auto am_i_root = coupler.get_option<bool>("am_i_root");
       scream::p3::p3_init(/*write_tables=*/false, am_i_root);
       pam::p3_init_lookup_tables(); // Load P3 lookup table data - avoid re-loading every CRM call
+      ctx.p3_tables_loaded = true;
     }
   #endif
 
@@ -241,7 +292,7 @@ extern "C" void pam_driver() {
   while (nstep < nstop) {
     //--------------------------------------------------------------------------
     //--------------------------------------------------------------------------
-    auto num_subcycle = pam_driver_set_subcycle_timestep(coupler,crm_dt_fixed);
+    auto num_subcycle = pam_driver_set_subcycle_timestep(coupler,ctx,crm_dt_fixed);
     #if defined(MMF_PAM_DYCOR_SPAM)
       dycore.update_dt(coupler);
     #endif
@@ -341,6 +392,7 @@ extern "C" void pam_driver() {
 }
 
 extern "C" void pam_finalize() {
+  get_pam_driver_context().finalize();
   #if defined(P3_CXX) || defined(SHOC_CXX)
   pam::deallocate_scream_cxx_globals();
   // if using SL tracer advection then COMPOSE will call Kokkos::finalize(), otherwise, call it here
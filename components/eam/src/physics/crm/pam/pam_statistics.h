@@ -2,6 +2,7 @@
 
 #include "pam_coupler.h"
 #include "saturation_adjustment.h"
+#include "crm_horizontal_sum.h"
 
 // These routines are used to encapsulate the aggregation
 // of various quantities, such as precipitation
@@ -204,7 +205,6 @@ using yakl::c::parallel_for;
 
 inline void pam_statistics_aggregate_tendency( pam::PamCoupler &coupler, std::string scheme ) {
   using yakl::c::SimpleBounds;
-  using yakl::atomicAdd;
   auto &dm_device = coupler.get_data_manager_device_readwrite();
   auto &dm_host   = coupler.get_data_manager_host_readwrite();
   auto nens       = coupler.get_option<int>("ncrms");
@@ -270,23 +270,26 @@ inline void pam_statistics_aggregate_tendency( pam::PamCoupler &coupler, std::st
   // save temporary state for physics tendency calculation
   real r_crm_dt = 1._fp / crm_dt;  // precompute reciprocal to avoid costly divisions
   real r_nx_ny  = 1._fp / (nx*ny);  // precompute reciprocal to avoid costly divisions
-  parallel_for(SimpleBounds<4>(nz,ny,nx,nens), YAKL_LAMBDA (int k, int j, int i, int iens) {
-    real rho_total = rho_d(k,j,i,iens) + rho_v(k,j,i,iens);
-    real qv_tmp = rho_v(k,j,i,iens) / rho_total;
-    real qc_tmp = rho_l(k,j,i,iens) / rho_total;
-    real qi_tmp = rho_i(k,j,i,iens) / rho_total;
-    real qr_tmp = rho_r(k,j,i,iens) / rho_total;
-    real tmp_tend_temp = ( temp(k,j,i,iens) - phys_tend_save_temp(k,j,i,iens) )*r_crm_dt;
-    real tmp_tend_qv   = ( qv_tmp           - phys_tend_save_qv  (k,j,i,iens) )*r_crm_dt;
-    real tmp_tend_qc   = ( qc_tmp           - phys_tend_save_qc  (k,j,i,iens) )*r_crm_dt;
-    real tmp_tend_qi   = ( qi_tmp           - phys_tend_save_qi  (k,j,i,iens) )*r_crm_dt;
-    real tmp_tend_qr   = ( qr_tmp           - phys_tend_save_qr  (k,j,i,iens) )*r_crm_dt;
-    atomicAdd( phys_tend_temp(k,iens) ,  tmp_tend_temp*r_nx_ny );
-    atomicAdd( phys_tend_qv  (k,iens) ,  tmp_tend_qv  *r_nx_ny );
-    atomicAdd( phys_tend_qc  (k,iens) ,  tmp_tend_qc  *r_nx_ny );
-    atomicAdd( phys_tend_qi  (k,iens) ,  tmp_tend_qi  *r_nx_ny );
-    atomicAdd( phys_tend_qr  (k,iens) ,  tmp_tend_qr  *r_nx_ny );
-  });
+  crm_horizontal_sum<real,5>( nz, ny, nx, nens,
+    YAKL_LAMBDA (int k, int j, int i, int iens, yakl::SArray<real,1,5> &vals) {
+      real rho_total = rho_d(k,j,i,iens) + rho_v(k,j,i,iens);
+      real qv_tmp = rho_v(k,j,i,iens) / rho_total;
+      real qc_tmp = rho_l(k,j,i,iens) / rho_total;
+      real qi_tmp = rho_i(k,j,i,iens) / rho_total;
+      real qr_tmp = rho_r(k,j,i,iens) / rho_total;
+      vals(0) = ( temp(k,j,i,iens) - phys_tend_save_temp(k,j,i,iens) )*r_crm_dt;
+      vals(1) = ( qv_tmp           - phys_tend_save_qv  (k,j,i,iens) )*r_crm_dt;
+      vals(2) = ( qc_tmp           - phys_tend_save_qc  (k,j,i,iens) )*r_crm_dt;
+      vals(3) = ( qi_tmp           - phys_tend_save_qi  (k,j,i,iens) )*r_crm_dt;
+      vals(4) = ( qr_tmp           - phys_tend_save_qr  (k,j,i,iens) )*r_crm_dt;
+    },
+    YAKL_LAMBDA (int k, int iens, yakl::SArray<real,1,5> const &sums) {
+      phys_tend_temp(k,iens) += sums(0)*r_nx_ny;
+      phys_tend_qv  (k,iens) += sums(1)*r_nx_ny;
+      phys_tend_qc  (k,iens) += sums(2)*r_nx_ny;
+      phys_tend_qi  (k,iens) += sums(3)*r_nx_ny;
+      phys_tend_qr  (k,iens) += sums(4)*r_nx_ny;
+    });
   // update aggregation count for phyics tendencies
   parallel_for(SimpleBounds<1>(nens), YAKL_LAMBDA (int iens) {
     phys_tend_cnt(iens) += 1;
@@ -299,7 +302,6 @@ inline void pam_statistics_aggregate_tendency( pam::PamCoupler &coupler, std::st
 inline void pam_statistics_timestep_aggregation( pam::PamCoupler &coupler ) {
   using yakl::c::parallel_for;
   using yakl::c::SimpleBounds;
-  using yakl::atomicAdd;
   auto &dm_device = coupler.get_data_manager_device_readwrite();
   auto &dm_host   = coupler.get_data_manager_host_readwrite();
   auto nens       = coupler.get_option<int>("ncrms");
@@ -351,32 +353,52 @@ inline void pam_statistics_timestep_aggregation( pam::PamCoupler &coupler ) {
   });
   real r_nx_ny  = 1._fp/(nx*ny);
   // aggregate 0D statistics
-  parallel_for(SimpleBounds<3>(ny,nx,nens), YAKL_LAMBDA (int j, int i, int iens) {
-    // NOTE - precip is already in m/s
-    atomicAdd( precip_liq_aggregated(iens), precip_liq(j,i,iens) * r_nx_ny );
-    atomicAdd( precip_ice_aggregated(iens), precip_ice(j,i,iens) * r_nx_ny );
-  });
+  crm_horizontal_sum<real,2>( 1, ny, nx, nens,
+    YAKL_LAMBDA (int k, int j, int i, int iens, yakl::SArray<real,1,2> &vals) {
+      // NOTE - precip is already in m/s
+      vals(0) = precip_liq(j,i,iens);
+      vals(1) = precip_ice(j,i,iens);
+    },
+    YAKL_LAMBDA (int k, int iens, yakl::SArray<real,1,2> const &sums) {
+      precip_liq_aggregated(iens) += sums(0) * r_nx_ny;
+      precip_ice_aggregated(iens) += sums(1) * r_nx_ny;
+    });
   // aggregate 1D statistics
-  parallel_for(SimpleBounds<4>(nz,ny,nx,nens), YAKL_LAMBDA (int k, int j, int i, int iens) {
-    int k_gcm = gcm_nlev-1-k;
-    real rho_total = rho_d(k,j,i,iens) + rho_v(k,j,i,iens);
-    atomicAdd( liqwp_aggregated(k,iens), (rho_l(k,j,i,iens)/rho_total) * r_nx_ny * input_pdel(k_gcm,iens)*1000.0/grav );
-    atomicAdd( icewp_aggregated(k,iens), (rho_i(k,j,i,iens)/rho_total) * r_nx_ny * input_pdel(k_gcm,iens)*1000.0/grav );
-    atomicAdd( liq_ice_exchange_aggregated(k,iens), liq_ice_exchange(k,j,i,iens) * r_nx_ny );
-    atomicAdd( vap_liq_exchange_aggregated(k,iens), vap_liq_exchange(k,j,i,iens) * r_nx_ny );
-    atomicAdd( vap_ice_exchange_aggregated(k,iens), vap_ice_exchange(k,j,i,iens) * r_nx_ny );
-    real rho_sum = rho_l(k,j,i,iens)+rho_i(k,j,i,iens);
-    real dz = (zint(k+1,iens) - zint(k,iens));
-    if ( ( rho_sum*dz ) > cld_threshold) {
-      atomicAdd( cldfrac_aggregated(k,iens), 1.*r_nx_ny );
-    } else {
-      // calculate RH from vapor pressure and saturation vapor pressure
-      real pv = rho_v(k,j,i,iens) * R_v * temp(k,j,i,iens);
-      real svp = modules::saturation_vapor_pressure( temp(k,j,i,iens) );
-      atomicAdd( clear_rh    (k,iens), pv/svp );
-      atomicAdd( clear_rh_cnt(k,iens), 1. );
-    }
-  });
+  crm_horizontal_sum<real,8>( nz, ny, nx, nens,
+    YAKL_LAMBDA (int k, int j, int i, int iens, yakl::SArray<real,1,8> &vals) {
+      real rho_total = rho_d(k,j,i,iens) + rho_v(k,j,i,iens);
+      vals(0) = rho_l(k,j,i,iens)/rho_total;
+      vals(1) = rho_i(k,j,i,iens)/rho_total;
+      vals(2) = liq_ice_exchange(k,j,i,iens);
+      vals(3) = vap_liq_exchange(k,j,i,iens);
+      vals(4) = vap_ice_exchange(k,j,i,iens);
+      real rho_sum = rho_l(k,j,i,iens)+rho_i(k,j,i,iens);
+      real dz = (zint(k+1,iens) - zint(k,iens));
+      if ( ( rho_sum*dz ) > cld_threshold) {
+        vals(5) = 1.;
+        vals(6) = 0.;
+        vals(7) = 0.;
+      } else {
+        // calculate RH from vapor pressure and saturation vapor pressure
+        real pv = rho_v(k,j,i,iens) * R_v * temp(k,j,i,iens);
+        real svp = modules::saturation_vapor_pressure( temp(k,j,i,iens) );
+        vals(5) = 0.;
+        vals(6) = pv/svp;
+        vals(7) = 1.;
+      }
+    },
+    YAKL_LAMBDA (int k, int iens, yakl::SArray<real,1,8> const &sums) {
+      int k_gcm = gcm_nlev-1-k;
+      real dp_fac = input_pdel(k_gcm,iens)*1000.0/grav;
+      liqwp_aggregated(k,iens)            += sums(0) * r_nx_ny * dp_fac;
+      icewp_aggregated(k,iens)            += sums(1) * r_nx_ny * dp_fac;
+      liq_ice_exchange_aggregated(k,iens) += sums(2) * r_nx_ny;
+      vap_liq_exchange_aggregated(k,iens) += sums(3) * r_nx_ny;
+      vap_ice_exchange_aggregated(k,iens) += sums(4) * r_nx_ny;
+      cldfrac_aggregated(k,iens)          += sums(5) * r_nx_ny;
+      clear_rh    (k,iens)                += sums(6);
+      clear_rh_cnt(k,iens)                += sums(7);
+    });
   parallel_for(SimpleBounds<2>(nz,nens), YAKL_LAMBDA (int k, int iens) {
     rho_v_forcing_aggregated(k,iens) += gcm_forcing_tend_rho_v(k,iens);
     rho_l_forcing_aggregated(k,iens) += gcm_forcing_tend_rho_l(k,iens);
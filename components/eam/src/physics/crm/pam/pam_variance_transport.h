@@ -1,6 +1,7 @@
 #pragma once
 
 #include "pam_coupler.h"
+#include "crm_horizontal_sum.h"
 
 
 inline void pam_variance_transport_init( pam::PamCoupler &coupler ) {
@@ -53,39 +54,39 @@ inline void pam_variance_transport_diagnose( pam::PamCoupler &coupler ) {
   real2d rhov_mean("rhov_mean", nz, nens);
   real2d uvel_mean("uvel_mean", nz, nens);
   //------------------------------------------------------------------------------------------------
-  // initialize variance and horizontal mean
-  parallel_for( SimpleBounds<2>(nz,nens) , YAKL_LAMBDA (int k, int n) {
-    temp_mean(k,n) = 0.0;
-    rhov_mean(k,n) = 0.0;
-    uvel_mean(k,n) = 0.0;
-    vt_temp(k,n)   = 0.0;
-    vt_rhov(k,n)   = 0.0;
-    vt_uvel(k,n)   = 0.0;
-  });
-  //------------------------------------------------------------------------------------------------
   // calculate horizontal mean
   real r_nx_ny  = 1._fp/(nx*ny);  // precompute reciprocal to avoid costly divisions
-  parallel_for(SimpleBounds<4>(nz,ny,nx,nens), YAKL_LAMBDA (int k, int j, int i, int n) {
-    real rhot = rhov(k,j,i,n) + rhoc(k,j,i,n) + rhoi(k,j,i,n);
-    yakl::atomicAdd( temp_mean(k,n), temp(k,j,i,n)*r_nx_ny );
-    yakl::atomicAdd( rhov_mean(k,n), rhot         *r_nx_ny );
-    yakl::atomicAdd( uvel_mean(k,n), uvel(k,j,i,n)*r_nx_ny );
-  });
+  crm_horizontal_sum<real,3>( nz, ny, nx, nens,
+    YAKL_LAMBDA (int k, int j, int i, int n, yakl::SArray<real,1,3> &vals) {
+      vals(0) = temp(k,j,i,n);
+      vals(1) = rhov(k,j,i,n) + rhoc(k,j,i,n) + rhoi(k,j,i,n);
+      vals(2) = uvel(k,j,i,n);
+    },
+    YAKL_LAMBDA (int k, int n, yakl::SArray<real,1,3> const &sums) {
+      temp_mean(k,n) = sums(0)*r_nx_ny;
+      rhov_mean(k,n) = sums(1)*r_nx_ny;
+      uvel_mean(k,n) = sums(2)*r_nx_ny;
+    });
   //------------------------------------------------------------------------------------------------
-  // calculate fluctuations from horz mean
-  parallel_for(SimpleBounds<4>(nz,ny,nx,nens), YAKL_LAMBDA (int k, int j, int i, int n) {
-    real rhot = rhov(k,j,i,n) + rhoc(k,j,i,n) + rhoi(k,j,i,n);
-    vt_temp_pert(k,j,i,n) = temp(k,j,i,n) - temp_mean(k,n);
-    vt_rhov_pert(k,j,i,n) = rhot          - rhov_mean(k,n);
-    vt_uvel_pert(k,j,i,n) = uvel(k,j,i,n) - uvel_mean(k,n);
-  });
-  //------------------------------------------------------------------------------------------------
-  // calculate variance
-  parallel_for(SimpleBounds<4>(nz,ny,nx,nens), YAKL_LAMBDA (int k, int j, int i, int n) {
-    yakl::atomicAdd( vt_temp(k,n), ( vt_temp_pert(k,j,i,n) * vt_temp_pert(k,j,i,n) ) * r_nx_ny );
-    yakl::atomicAdd( vt_rhov(k,n), ( vt_rhov_pert(k,j,i,n) * vt_rhov_pert(k,j,i,n) ) * r_nx_ny );
-    yakl::atomicAdd( vt_uvel(k,n), ( vt_uvel_pert(k,j,i,n) * vt_uvel_pert(k,j,i,n) ) * r_nx_ny );
-  });
+  // calculate fluctuations from horz mean and their variance in a single sweep
+  crm_horizontal_sum<real,3>( nz, ny, nx, nens,
+    YAKL_LAMBDA (int k, int j, int i, int n, yakl::SArray<real,1,3> &vals) {
+      real rhot = rhov(k,j,i,n) + rhoc(k,j,i,n) + rhoi(k,j,i,n);
+      real temp_pert = temp(k,j,i,n) - temp_mean(k,n);
+      real rhov_pert = rhot          - rhov_mean(k,n);
+      real uvel_pert = uvel(k,j,i,n) - uvel_mean(k,n);
+      vt_temp_pert(k,j,i,n) = temp_pert;
+      vt_rhov_pert(k,j,i,n) = rhov_pert;
+      vt_uvel_pert(k,j,i,n) = uvel_pert;
+      vals(0) = temp_pert * temp_pert;
+      vals(1) = rhov_pert * rhov_pert;
+      vals(2) = uvel_pert * uvel_pert;
+    },
+    YAKL_LAMBDA (int k, int n, yakl::SArray<real,1,3> const &sums) {
+      vt_temp(k,n) = sums(0)*r_nx_ny;
+      vt_rhov(k,n) = sums(1)*r_nx_ny;
+      vt_uvel(k,n) = sums(2)*r_nx_ny;
+    });
   //------------------------------------------------------------------------------------------------
 }
 
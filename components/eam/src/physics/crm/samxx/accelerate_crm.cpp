@@ -1,5 +1,6 @@
 
 #include "accelerate_crm.h"
+#include "crm_horizontal_sum.h"
 
 void accelerate_crm(int nstep, int nstop, bool &ceaseflag) {
   YAKL_SCOPE( t                  , ::t);
@@ -37,30 +38,26 @@ void accelerate_crm(int nstep, int nstop, bool &ceaseflag) {
   // Compute the average among horizontal columns for each variable
   // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 
-  // for (int k=0; k<nzm; k++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-    tbaccel(k,icrm) = 0.0;
-    qtbaccel(k,icrm) = 0.0;
-    if (crm_accel_uv) {
-      ubaccel(k,icrm) = 0.0;
-      vbaccel(k,icrm) = 0.0;
-    }
-  });
-
   // for (int k=0; k<nzm; k++) {
   //   for (int j=0; j<ny; j++) {
   //     for (int i=0; i<nx; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    // calculate tendency * dtn
-    yakl::atomicAdd( tbaccel(k,icrm) , t(k,j+offy_s,i+offx_s,icrm) * crm_accel_coef );
-    yakl::atomicAdd( qtbaccel(k,icrm) , (qcl(k,j,i,icrm) + qci(k,j,i,icrm) + qv(k,j,i,icrm)) * crm_accel_coef );
-    if (crm_accel_uv) {
-      yakl::atomicAdd( ubaccel(k,icrm) , u(k,j+offy_u,i+offx_u,icrm) * crm_accel_coef );
-      yakl::atomicAdd( vbaccel(k,icrm) , v(k,j+offy_v,i+offx_v,icrm) * crm_accel_coef );
-    }
-  });
+  crm_horizontal_sum<real,4>( nzm, ny, nx, ncrms ,
+    YAKL_LAMBDA (int k, int j, int i, int icrm, SArray<real,1,4> &vals) {
+      // calculate tendency * dtn
+      vals(0) = t(k,j+offy_s,i+offx_s,icrm) * crm_accel_coef;
+      vals(1) = (qcl(k,j,i,icrm) + qci(k,j,i,icrm) + qv(k,j,i,icrm)) * crm_accel_coef;
+      vals(2) = crm_accel_uv ? u(k,j+offy_u,i+offx_u,icrm) * crm_accel_coef : 0.0;
+      vals(3) = crm_accel_uv ? v(k,j+offy_v,i+offx_v,icrm) * crm_accel_coef : 0.0;
+    } ,
+    YAKL_LAMBDA (int k, int icrm, SArray<real,1,4> const &sums) {
+      tbaccel(k,icrm) = sums(0);
+      qtbaccel(k,icrm) = sums(1);
+      if (crm_accel_uv) {
+        ubaccel(k,icrm) = sums(2);
+        vbaccel(k,icrm) = sums(3);
+      }
+    });
 
   //!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
   //!! Compute the accelerated tendencies
@@ -132,26 +129,21 @@ void accelerate_crm(int nstep, int nstop, bool &ceaseflag) {
   //!! Fix negative micro and readjust among separate water species
   //!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 
-  // for (int k=0; k<nzm; k++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-    qpoz(k,icrm) = 0.0;
-    qneg(k,icrm) = 0.0;
-  });
-
   // separately accumulate positive and negative qt values in each layer k
   // for (int k=0; k<nzm; k++) {
   //   for (int j=0; j<ny; j++) {
   //     for (int i=0; i<nx; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    if (micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) < 0.0) {
-      yakl::atomicAdd( qneg(k,icrm) , micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) ); 
-    }
-    else {
-      yakl::atomicAdd( qpoz(k,icrm) , micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) );
-    }
-  });
+  crm_horizontal_sum<real,2>( nzm, ny, nx, ncrms ,
+    YAKL_LAMBDA (int k, int j, int i, int icrm, SArray<real,1,2> &vals) {
+      real qt = micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm);
+      vals(0) = qt < 0.0 ? qt : 0.0;
+      vals(1) = qt < 0.0 ? 0.0 : qt;
+    } ,
+    YAKL_LAMBDA (int k, int icrm, SArray<real,1,2> const &sums) {
+      qneg(k,icrm) = sums(0);
+      qpoz(k,icrm) = sums(1);
+    });
 
   // for (int k=0; k<nzm; k++) {
   //   for (int j=0; j<ny; j++) {
@@ -1,4 +1,5 @@
 #include "crm_variance_transport.h"
+#include "crm_horizontal_sum.h"
 
 //==============================================================================
 //==============================================================================
@@ -85,40 +86,26 @@ void VT_diagnose() {
   //----------------------------------------------------------------------------
   // calculate horizontal mean
   //----------------------------------------------------------------------------
-  // do k = 1,nzm
-  //   do icrm = 1,ncrms
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-      t_mean(k,icrm) = 0.0;
-      q_mean(k,icrm) = 0.0;
-      u_mean(k,icrm) = 0.0;
-      t_vt(k,icrm) = 0.0;
-      q_vt(k,icrm) = 0.0;
-      u_vt(k,icrm) = 0.0;
-  });
-
   // do k = 1,nzm
   //  do j = 1,ny
   //    do i = 1,nx
   //      do icrm = 1,ncrms
-  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    yakl::atomicAdd( t_mean(k,icrm) , t(k,j+offy_s,i+offx_s,icrm) );
-    yakl::atomicAdd( q_mean(k,icrm) , micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) );
-    yakl::atomicAdd( u_mean(k,icrm) , u(k,j+offy_u,i+offx_u,icrm) );
-  });
-
-  // do k = 1,nzm
-  //   do icrm = 1,ncrms
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-      t_mean(k,icrm) = t_mean(k,icrm) * factor_xy ;
-      q_mean(k,icrm) = q_mean(k,icrm) * factor_xy ;
-      u_mean(k,icrm) = u_mean(k,icrm) * factor_xy ;
-  });
+  crm_horizontal_sum<real,3>( nzm, ny, nx, ncrms ,
+    YAKL_LAMBDA (int k, int j, int i, int icrm, SArray<real,1,3> &vals) {
+      vals(0) = t(k,j+offy_s,i+offx_s,icrm);
+      vals(1) = micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm);
+      vals(2) = u(k,j+offy_u,i+offx_u,icrm);
+    } ,
+    YAKL_LAMBDA (int k, int icrm, SArray<real,1,3> const &sums) {
+      t_mean(k,icrm) = sums(0) * factor_xy;
+      q_mean(k,icrm) = sums(1) * factor_xy;
+      u_mean(k,icrm) = sums(2) * factor_xy;
+    });
 
   //----------------------------------------------------------------------------
   // calculate fluctuations - either from horz mean or with a low-pass filter
   //----------------------------------------------------------------------------
   if (VT_wn_max>0) { // use filtered state for fluctuations
-  
 
     real4d tmp_t("tmp_t", nzm, ny, nx, ncrms);
     real4d tmp_q("tmp_q", nzm, ny, nx, ncrms);
@@ -129,54 +116,58 @@ void VT_diagnose() {
     //     do i = 1,nx
     //       do icrm = 1,ncrms
     parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      tmp_t(k,j,i,icrm) = t(k,j+offy_s,i+offx_s,icrm);
-      tmp_q(k,j,i,icrm) = micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm);
-      tmp_t(k,j,i,icrm) = tmp_t(k,j,i,icrm) - t_mean(k,icrm);
-      tmp_q(k,j,i,icrm) = tmp_q(k,j,i,icrm) - q_mean(k,icrm);
-      tmp_u(k,j,i,icrm) = u(k,j+offy_u,i+offx_u,icrm);
-      tmp_u(k,j,i,icrm) = tmp_u(k,j,i,icrm) - u_mean(k,icrm);
+      tmp_t(k,j,i,icrm) = t(k,j+offy_s,i+offx_s,icrm) - t_mean(k,icrm);
+      tmp_q(k,j,i,icrm) = micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) - q_mean(k,icrm);
+      tmp_u(k,j,i,icrm) = u(k,j+offy_u,i+offx_u,icrm) - u_mean(k,icrm);
     });
 
     VT_filter( VT_wn_max, tmp_t, t_vt_pert );
     VT_filter( VT_wn_max, tmp_q, q_vt_pert );
     VT_filter( VT_wn_max, tmp_u, u_vt_pert );
 
+    //--------------------------------------------------------------------------
+    // calculate variance of the filtered fluctuations
+    //--------------------------------------------------------------------------
+    crm_horizontal_sum<real,3>( nzm, ny, nx, ncrms ,
+      YAKL_LAMBDA (int k, int j, int i, int icrm, SArray<real,1,3> &vals) {
+        vals(0) = t_vt_pert(k,j,i,icrm) * t_vt_pert(k,j,i,icrm);
+        vals(1) = q_vt_pert(k,j,i,icrm) * q_vt_pert(k,j,i,icrm);
+        vals(2) = u_vt_pert(k,j,i,icrm) * u_vt_pert(k,j,i,icrm);
+      } ,
+      YAKL_LAMBDA (int k, int icrm, SArray<real,1,3> const &sums) {
+        t_vt(k,icrm) = sums(0) * factor_xy;
+        q_vt(k,icrm) = sums(1) * factor_xy;
+        u_vt(k,icrm) = sums(2) * factor_xy;
+      });
+
   } else { // use total variance
 
+    //--------------------------------------------------------------------------
+    // calculate fluctuations and their variance in the same sweep
+    //--------------------------------------------------------------------------
     // do k = 1,nzm
     //   do j = 1,ny
     //     do i = 1,nx
     //       do icrm = 1,ncrms
-    parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-      t_vt_pert(k,j,i,icrm) = t(k,j+offy_s,i+offx_s,icrm) - t_mean(k,icrm);
-      q_vt_pert(k,j,i,icrm) = micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) - q_mean(k,icrm);
-      u_vt_pert(k,j,i,icrm) = u(k,j+offy_u,i+offx_u,icrm) - u_mean(k,icrm);
-    });
-    
-  }
+    crm_horizontal_sum<real,3>( nzm, ny, nx, ncrms ,
+      YAKL_LAMBDA (int k, int j, int i, int icrm, SArray<real,1,3> &vals) {
+        real t_pert = t(k,j+offy_s,i+offx_s,icrm) - t_mean(k,icrm);
+        real q_pert = micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) - q_mean(k,icrm);
+        real u_pert = u(k,j+offy_u,i+offx_u,icrm) - u_mean(k,icrm);
+        t_vt_pert(k,j,i,icrm) = t_pert;
+        q_vt_pert(k,j,i,icrm) = q_pert;
+        u_vt_pert(k,j,i,icrm) = u_pert;
+        vals(0) = t_pert * t_pert;
+        vals(1) = q_pert * q_pert;
+        vals(2) = u_pert * u_pert;
+      } ,
+      YAKL_LAMBDA (int k, int icrm, SArray<real,1,3> const &sums) {
+        t_vt(k,icrm) = sums(0) * factor_xy;
+        q_vt(k,icrm) = sums(1) * factor_xy;
+        u_vt(k,icrm) = sums(2) * factor_xy;
+      });
 
-  //----------------------------------------------------------------------------
-  // calculate variance
-  //----------------------------------------------------------------------------
-
-  // do k = 1,nzm
-  //   do j = 1,ny
-  //     do i = 1,nx
-  //       do icrm = 1,ncrms
-  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    yakl::atomicAdd( t_vt(k,icrm) , t_vt_pert(k,j,i,icrm) * t_vt_pert(k,j,i,icrm) );
-    yakl::atomicAdd( q_vt(k,icrm) , q_vt_pert(k,j,i,icrm) * q_vt_pert(k,j,i,icrm) );
-    yakl::atomicAdd( u_vt(k,icrm) , u_vt_pert(k,j,i,icrm) * u_vt_pert(k,j,i,icrm) );
-  });
-
-
-  // do k = 1,nzm
-  //   do icrm = 1,ncrms
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-    t_vt(k,icrm) = t_vt(k,icrm) * factor_xy ;
-    q_vt(k,icrm) = q_vt(k,icrm) * factor_xy ;
-    u_vt(k,icrm) = u_vt(k,icrm) * factor_xy ;
-  });
+  }
 
   //----------------------------------------------------------------------------
   //----------------------------------------------------------------------------
@@ -20,8 +20,8 @@ void diffuse_scalar2D(real4d &field, real3d &fluxb, real3d &fluxt, real5d &tkh,
     int constexpr offx_flx = 1;
     int constexpr offz_flx = 1;
 
-    real4d flx("flx", nzm+1, 1, nx+1, ncrms);
-    real4d dfdt("dfdt", nzm, ny, nx, ncrms);
+    YAKL_SCOPE( flx  , ::diffuse_flx_x );
+    YAKL_SCOPE( dfdt , ::diffuse_dfdt );
 
     // for (int k=0; k<nzm; k++) {
     //  for (int i=0; i<nx; i++) {
@@ -109,8 +109,8 @@ void diffuse_scalar2D(real5d &field, int ind_field, real3d &fluxb, real3d &fluxt
     int constexpr offx_flx = 1;
     int constexpr offz_flx = 1;
 
-    real4d flx("flx", nzm+1, 1, nx+1, ncrms);
-    real4d dfdt("dfdt", nzm, ny, nx, ncrms);
+    YAKL_SCOPE( flx  , ::diffuse_flx_x );
+    YAKL_SCOPE( dfdt , ::diffuse_dfdt );
 
     // for (int k=0; k<nzm; k++) {
     //  for (int i=0; i<nx; i++) {
@@ -198,8 +198,8 @@ void diffuse_scalar2D(real5d &field, int ind_field, real4d &fluxb, int ind_fluxb
     int constexpr offx_flx = 1;
     int constexpr offz_flx = 1;
 
-    real4d flx("flx", nzm+1, 1, nx+1, ncrms);
-    real4d dfdt("dfdt", nzm, ny, nx, ncrms);
+    YAKL_SCOPE( flx  , ::diffuse_flx_x );
+    YAKL_SCOPE( dfdt , ::diffuse_dfdt );
 
     // for (int k=0; k<nzm; k++) {
     //  for (int i=0; i<nx; i++) {
@@ -24,21 +24,22 @@ void precip_fall(int hydro_type, real4d &omega) {
   YAKL_SCOPE( a_pr          , :: a_pr );
   YAKL_SCOPE( a_gr          , :: a_gr );
   YAKL_SCOPE( ncrms         , :: ncrms );
+  // Work arrays
+  YAKL_SCOPE( mx            , :: precip_fall_mx );
+  YAKL_SCOPE( mn            , :: precip_fall_mn );
+  YAKL_SCOPE( lfac          , :: precip_fall_lfac );
+  YAKL_SCOPE( www           , :: precip_fall_www );
+  YAKL_SCOPE( fz            , :: precip_fall_fz );
+  YAKL_SCOPE( wp            , :: precip_fall_wp );
+  YAKL_SCOPE( tmp_qp        , :: precip_fall_tmp_qp );
+  YAKL_SCOPE( irhoadz       , :: precip_fall_irhoadz );
+  YAKL_SCOPE( iwmax         , :: precip_fall_iwmax );
+  YAKL_SCOPE( rhofac        , :: precip_fall_rhofac );
+  YAKL_SCOPE( prec_cfl_arr  , :: precip_fall_cfl );
 
   real constexpr eps = 1.e-10;
   bool constexpr nonos = true;
 
-  real4d mx("mx",nzm,ny,nx,ncrms);
-  real4d mn("mn",nzm,ny,nx,ncrms);
-  real4d lfac("lfac",nz,ny,nx,ncrms);
-  real4d www("www",nz,ny,nx,ncrms);
-  real4d fz("fz",nz,ny,nx,ncrms);
-  real4d wp("wp",nzm,ny,nx,ncrms);
-  real4d tmp_qp("tmp_qp",nzm,ny,nx,ncrms);
-  real2d irhoadz("irhoadz",nzm,ncrms);
-  real2d iwmax("iwmax",nzm,ncrms);
-  real2d rhofac("rhofac",nzm,ncrms);
-
   // for (int k=0; k<nzm; k++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
@@ -51,7 +52,6 @@ void precip_fall(int hydro_type, real4d &omega) {
 
   //  Add sedimentation of precipitation field to the vert. vel.
   real prec_cfl = 0.0;
-  real4d prec_cfl_arr("prec_cfl_arr",nzm,ny,nx,ncrms);
 
   // for (int k=0; k<nzm; k++) {
   //   for (int j=0; j<ny; j++) {
@@ -254,8 +254,7 @@ void micro_precip_fall() {
   YAKL_SCOPE( tabs  , ::tabs );
   YAKL_SCOPE( a_pr  , ::a_pr );
   YAKL_SCOPE( ncrms , ::ncrms );
-
-  real4d omega("omega", nzm, ny, nx, ncrms);
+  YAKL_SCOPE( omega , ::micro_omega );
 
   crain = b_rain / 4.0;
   csnow = b_snow / 4.0;
@@ -12,8 +12,7 @@ void kurant_sgs(real &cfl) {
   YAKL_SCOPE( grdf_y         , :: grdf_y );
   YAKL_SCOPE( grdf_z         , :: grdf_z );
   YAKL_SCOPE( ncrms          , :: ncrms );
-
-  real2d tkhmax("tkhmax",nzm,ncrms);
+  YAKL_SCOPE( tkhmax         , :: sgs_tkhmax );
 
   // for (int k=0; k<nzm; k++) {
   //   for (int icrm=0; icrm<ncrms; icrm++) {
@@ -81,7 +80,7 @@ void sgs_mom() {
 
 void sgs_scalars() {
   YAKL_SCOPE( use_ESMT, :: use_ESMT );
-  real2d dummy("dummy", nz, ncrms);
+  YAKL_SCOPE( dummy, :: sgs_dummy );
 
   diffuse_scalar(sgs_field_diag,1,t,fluxbt,fluxtt,tdiff,twsb);
 
@@ -0,0 +1,75 @@
+
+// Times the variance transport kernels (VT_diagnose and VT_forcing) on
+// synthetic CRM states, for a range of ncrms values. The CRM dimensions
+// are the ones of the 3D build (see DEFS3D in build/cmakescript.sh).
+//
+//   ./vt_bench [nrep] [ncrms_1 ncrms_2 ...]
+
+#include "vars.h"
+#include "crm_variance_transport.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+void fill_state() {
+  YAKL_SCOPE( t           , :: t);
+  YAKL_SCOPE( u           , :: u);
+  YAKL_SCOPE( micro_field , :: micro_field);
+  YAKL_SCOPE( t_vt_tend   , :: t_vt_tend);
+  YAKL_SCOPE( q_vt_tend   , :: q_vt_tend);
+  YAKL_SCOPE( u_vt_tend   , :: u_vt_tend);
+
+  int idx_qt = index_water_vapor;
+
+  // smooth but non-trivial perturbations, so that all wavenumbers are present
+  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    real phase = 0.37*i + 0.61*j + 0.13*icrm;
+    t(k,j+offy_s,i+offx_s,icrm) = 300.0 - 0.5*k + sin(phase) + 0.1*cos(7.0*phase);
+    micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) = 1.0e-2 * (1.0 + 0.1*cos(phase));
+    u(k,j+offy_u,i+offx_u,icrm) = 5.0 + 2.0*sin(3.0*phase);
+  });
+  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+    t_vt_tend(k,icrm) =  1.0e-4;
+    q_vt_tend(k,icrm) = -1.0e-10;
+    u_vt_tend(k,icrm) =  1.0e-4;
+  });
+}
+
+double time_kernel(int nrep, void (*kernel)()) {
+  kernel();   // warm up (e.g., FFT plans)
+  yakl::fence();
+  auto beg = std::chrono::steady_clock::now();
+  for (int n=0; n<nrep; n++) { kernel(); }
+  yakl::fence();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(end-beg).count() / nrep;
+}
+
+int main(int argc, char **argv) {
+  yakl::init();
+  {
+    int nrep = argc > 1 ? atoi(argv[1]) : 100;
+    std::vector<int> ncrms_list;
+    for (int n=2; n<argc; n++) { ncrms_list.push_back(atoi(argv[n])); }
+    if (ncrms_list.empty()) { ncrms_list = {16, 64, 256, 1024}; }
+
+    std::cout << "nx=" << nx << " ny=" << ny << " nzm=" << nzm << " nrep=" << nrep << "\n";
+    std::cout << "ncrms  VT_wn_max  VT_diagnose[s]  VT_forcing[s]\n";
+    for (int nc : ncrms_list) {
+      ncrms = nc;
+      allocate();
+      factor_xy = 1.0/( (real) nx * (real) ny );
+      dtn = crm_dt;
+      for (int wn : {0, 1}) {
+        VT_wn_max = wn;
+        fill_state();
+        double t_diag = time_kernel(nrep, VT_diagnose);
+        double t_forc = time_kernel(nrep, VT_forcing);
+        std::cout << nc << "  " << wn << "  " << t_diag << "  " << t_forc << "\n";
+      }
+      finalize();
+    }
+  }
+  yakl::finalize();
+}
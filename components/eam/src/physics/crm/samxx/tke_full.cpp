@@ -30,6 +30,10 @@ void tke_full(real5d &tke, int ind_tke, real5d &tk, int ind_tk, real5d &tkh, int
   YAKL_SCOPE( sgs_field      , :: sgs_field );
   YAKL_SCOPE( sgs_field_diag , :: sgs_field_diag );
   YAKL_SCOPE( ncrms          , :: ncrms );
+  // Work arrays
+  YAKL_SCOPE( def2           , :: tke_def2 );
+  YAKL_SCOPE( buoy_sgs_vert  , :: tke_buoy_sgs_vert );
+  YAKL_SCOPE( a_prod_bu_vert , :: tke_a_prod_bu_vert );
 
   real constexpr tk_min_value = 0.05;
   real constexpr tk_min_depth = 500.0;
@@ -39,10 +43,6 @@ void tke_full(real5d &tke, int ind_tke, real5d &tk, int ind_tk, real5d &tkh, int
   real constexpr Ces = Ce/0.7*3.0;
   real constexpr Pr = 1.0;
 
-  real4d def2("def2", nzm, ny, nx, ncrms);
-  real4d buoy_sgs_vert("buoy_sgs_vert", nzm+1,ny,nx,ncrms);
-  real4d a_prod_bu_vert("buoy_sgs_vert", nzm+1,ny,nx,ncrms);
-
   if (RUN3D) {
     shear_prod3D(def2);
   } else {
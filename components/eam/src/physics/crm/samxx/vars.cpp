@@ -193,6 +193,36 @@ void allocate() {
   q_vt_pert        = real4d( "q_vt_pert      "     , nzm , ny         , nx     , ncrms ); 
   u_vt_pert        = real4d( "u_vt_pert      "     , nzm , ny         , nx     , ncrms ); 
 
+  // Work arrays of the microphysics and sgs routines. They are allocated here, rather than
+  // in each call, since those routines are called (several times) at every CRM time step.
+  precip_fall_mx   = real4d( "precip_fall_mx "     , nzm , ny         , nx     , ncrms ); 
+  precip_fall_mn   = real4d( "precip_fall_mn "     , nzm , ny         , nx     , ncrms ); 
+  precip_fall_lfac = real4d( "precip_fall_lfac"     , nz  , ny         , nx     , ncrms ); 
+  precip_fall_www  = real4d( "precip_fall_www"     , nz  , ny         , nx     , ncrms ); 
+  precip_fall_fz   = real4d( "precip_fall_fz "     , nz  , ny         , nx     , ncrms ); 
+  precip_fall_wp   = real4d( "precip_fall_wp "     , nzm , ny         , nx     , ncrms ); 
+  precip_fall_tmp_qp = real4d( "precip_fall_tmp_qp"     , nzm , ny         , nx     , ncrms ); 
+  precip_fall_cfl  = real4d( "precip_fall_cfl"     , nzm , ny         , nx     , ncrms ); 
+  micro_omega      = real4d( "micro_omega    "     , nzm , ny         , nx     , ncrms ); 
+  tke_def2         = real4d( "tke_def2       "     , nzm , ny         , nx     , ncrms ); 
+  tke_buoy_sgs_vert = real4d( "tke_buoy_sgs_vert"     , nzm+1 , ny         , nx     , ncrms ); 
+  tke_a_prod_bu_vert = real4d( "tke_a_prod_bu_vert"     , nzm+1 , ny         , nx     , ncrms ); 
+  precip_fall_irhoadz = real2d( "precip_fall_irhoadz"                        , nzm    , ncrms ); 
+  precip_fall_iwmax = real2d( "precip_fall_iwmax"                        , nzm    , ncrms ); 
+  precip_fall_rhofac = real2d( "precip_fall_rhofac"                        , nzm    , ncrms ); 
+  sgs_tkhmax       = real2d( "sgs_tkhmax     "                        , nzm    , ncrms ); 
+  sgs_dummy        = real2d( "sgs_dummy      "                        , nz     , ncrms ); 
+  diffuse_df       = real4d( "diffuse_df     "     , nzm , dimy_s     , dimx_s , ncrms ); 
+  if (RUN3D) {
+    diffuse_flx_x  = real4d( "diffuse_flx_x  "     , nzm+1 , ny+1     , nx+1   , ncrms ); 
+    diffuse_flx_y  = real4d( "diffuse_flx_y  "     , nzm+1 , ny+1     , nx+1   , ncrms ); 
+    diffuse_flx_z  = real4d( "diffuse_flx_z  "     , nzm+1 , ny+1     , nx+1   , ncrms ); 
+    diffuse_dfdt   = real4d( "diffuse_dfdt   "     , nz  , ny         , nx     , ncrms ); 
+  } else {
+    diffuse_flx_x  = real4d( "diffuse_flx_x  "     , nzm+1 , 1        , nx+1   , ncrms ); 
+    diffuse_dfdt   = real4d( "diffuse_dfdt   "     , nzm , ny         , nx     , ncrms ); 
+  }
+
   yakl::memset(t00               ,0.);
   yakl::memset(tln               ,0.);
   yakl::memset(qln               ,0.);
@@ -666,6 +696,28 @@ void finalize() {
   t_vt_pert        = real4d();
   q_vt_pert        = real4d();
   u_vt_pert        = real4d();
+  precip_fall_mx   = real4d();
+  precip_fall_mn   = real4d();
+  precip_fall_lfac = real4d();
+  precip_fall_www  = real4d();
+  precip_fall_fz   = real4d();
+  precip_fall_wp   = real4d();
+  precip_fall_tmp_qp = real4d();
+  precip_fall_cfl  = real4d();
+  micro_omega      = real4d();
+  tke_def2         = real4d();
+  tke_buoy_sgs_vert = real4d();
+  tke_a_prod_bu_vert = real4d();
+  diffuse_df       = real4d();
+  diffuse_flx_x    = real4d();
+  diffuse_flx_y    = real4d();
+  diffuse_flx_z    = real4d();
+  diffuse_dfdt     = real4d();
+  precip_fall_irhoadz = real2d();
+  precip_fall_iwmax = real2d();
+  precip_fall_rhofac = real2d();
+  sgs_tkhmax       = real2d();
+  sgs_dummy        = real2d();
 
   yakl::fence();
 
@@ -1627,6 +1679,29 @@ real4d t_vt_pert      ;
 real4d q_vt_pert      ;
 real4d u_vt_pert      ;
 
+real4d precip_fall_mx ;
+real4d precip_fall_mn ;
+real4d precip_fall_lfac;
+real4d precip_fall_www;
+real4d precip_fall_fz ;
+real4d precip_fall_wp ;
+real4d precip_fall_tmp_qp;
+real4d precip_fall_cfl;
+real4d micro_omega    ;
+real4d tke_def2       ;
+real4d tke_buoy_sgs_vert;
+real4d tke_a_prod_bu_vert;
+real4d diffuse_df     ;
+real4d diffuse_flx_x  ;
+real4d diffuse_flx_y  ;
+real4d diffuse_flx_z  ;
+real4d diffuse_dfdt   ;
+real2d precip_fall_irhoadz;
+real2d precip_fall_iwmax;
+real2d precip_fall_rhofac;
+real2d sgs_tkhmax     ;
+real2d sgs_dummy      ;
+
 real1d fcorz           ;
 real1d fcor            ;
 real1d longitude0      ;
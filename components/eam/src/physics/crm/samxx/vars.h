@@ -337,6 +337,30 @@ extern real4d t_vt_pert      ;
 extern real4d q_vt_pert      ;
 extern real4d u_vt_pert      ;
 
+// Work arrays of the microphysics and sgs routines (see allocate)
+extern real4d precip_fall_mx ;
+extern real4d precip_fall_mn ;
+extern real4d precip_fall_lfac;
+extern real4d precip_fall_www;
+extern real4d precip_fall_fz ;
+extern real4d precip_fall_wp ;
+extern real4d precip_fall_tmp_qp;
+extern real4d precip_fall_cfl;
+extern real4d micro_omega    ;
+extern real4d tke_def2       ;
+extern real4d tke_buoy_sgs_vert;
+extern real4d tke_a_prod_bu_vert;
+extern real4d diffuse_df     ;
+extern real4d diffuse_flx_x  ;
+extern real4d diffuse_flx_y  ;
+extern real4d diffuse_flx_z  ;
+extern real4d diffuse_dfdt   ;
+extern real2d precip_fall_irhoadz;
+extern real2d precip_fall_iwmax;
+extern real2d precip_fall_rhofac;
+extern real2d sgs_tkhmax     ;
+extern real2d sgs_dummy      ;
+
 extern real1d fcorz           ;
 extern real1d fcor            ;
 extern real1d longitude0      ;
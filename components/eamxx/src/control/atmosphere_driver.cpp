@@ -481,6 +481,11 @@ void AtmosphereDriver::setup_column_conservation_checks ()
                    "Acceptable types are \"Warning\" and \"Fatal\".\n");
   }
 
+  // If requested, the check only accumulates column errors on device while
+  // processes run, and each process inspects them at the end of the time step.
+  m_deferred_conservation_checks = driver_options_pl.get<bool>("column_conservation_checks_deferred", false);
+  conservation_check->set_deferred(m_deferred_conservation_checks);
+
   // Pass energy checker to the process group to be added
   // to postcondition checks of appropriate processes.
   m_atm_process_group->setup_column_conservation_checks(conservation_check, fail_handling_type);
@@ -726,8 +731,20 @@ void AtmosphereDriver::create_output_managers () {
     // Store the "Output Control" pl of the model restart as the "Checkpoint Control" for all other output streams
     checkpoint_params.set<std::string>("frequency_units",params.sublist("output_control").get<std::string>("frequency_units"));
     checkpoint_params.set("Frequency",params.sublist("output_control").get<int>("Frequency"));
+
+    // If the model restart file is written asynchronously, the rpointer entries go in a
+    // pending file until the restart file is complete, so other OMs must append there.
+    if (params.get<int>("async_flush_vars_per_step",0)>0) {
+      checkpoint_params.set<std::string>("rpointer_filename","rpointer.atm.pending");
+    }
   }
 
+  // If requested, history output is snapshotted at output steps, and written to file
+  // while the following steps run (a few vars per step), rather than stalling the step.
+  // Individual yaml files can still override this.
+  const int async_vars_per_step =
+    m_atm_params.sublist("driver_options").get<int>("output_async_flush_vars_per_step",0);
+
   // Create one output manager per output yaml file
   using vos_t = std::vector<std::string>;
   const auto& output_yaml_files = io_params.get<vos_t>("output_yaml_files",vos_t{});
@@ -738,12 +755,18 @@ void AtmosphereDriver::create_output_managers () {
     auto& checkpoint_pl = params.sublist("Checkpoint Control");
     checkpoint_pl.set("frequency_units",checkpoint_params.get<std::string>("frequency_units"));
     checkpoint_pl.set("Frequency",checkpoint_params.get<int>("Frequency"));
+    if (checkpoint_params.isParameter("rpointer_filename")) {
+      checkpoint_pl.set("rpointer_filename",checkpoint_params.get<std::string>("rpointer_filename"));
+    }
 
     // Check if the filename prefix for this file has already been set.  If not, use the simulation casename.
     if (not params.isParameter("filename_prefix")) {
       params.set<std::string>("filename_prefix",m_casename+".scream.h");
     }
     params.sublist("provenance") = m_atm_params.sublist("provenance");
+    if (not params.isParameter("async_flush_vars_per_step")) {
+      params.set("async_flush_vars_per_step",async_vars_per_step);
+    }
 
     auto& om = m_output_managers.emplace_back();
     om.initialize(m_atm_comm,
@@ -786,13 +809,16 @@ void AtmosphereDriver::initialize_output_managers () {
     }
   }
 
-  // Setup output managers
+  // Setup output managers. They all share the same diagnostics registry, so that
+  // a diagnostic requested by multiple streams is only created and computed once.
+  auto diags_registry = std::make_shared<DiagnosticsRegistry>();
   for (auto& om : m_output_managers) {
     EKAT_REQUIRE_MSG(not om.is_restart(),
                      "Error! No restart output should be in m_output_managers. Model restart "
                      "output should be setup in m_restart_output_manager./n");
 
     om.set_logger(m_atm_logger);
+    om.set_diagnostics_registry(diags_registry);
     om.setup(m_field_mgrs,m_grids_manager);
   }
 
@@ -1686,6 +1712,11 @@ void AtmosphereDriver::run (const int dt) {
   // the individual processes, which will be called in the correct order.
   m_atm_process_group->run(dt);
 
+  // Report failures of deferred column conservation checks (if any)
+  if (m_deferred_conservation_checks) {
+    m_atm_process_group->run_deferred_column_conservation_checks();
+  }
+
   // Some accumulated fields need to be divided by dt at the end of the atm step
   for (auto fm_it : m_field_mgrs) {
     const auto& fm = fm_it.second;
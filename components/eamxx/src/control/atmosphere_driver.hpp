@@ -218,6 +218,9 @@ protected:
 
   std::shared_ptr<IntensiveObservationPeriod> m_iop;
 
+  // If true, column conservation check failures are reported at the end of the step
+  bool m_deferred_conservation_checks = false;
+
   // This is the time stamp at the beginning of the time step.
   util::TimeStamp                           m_current_ts;
 
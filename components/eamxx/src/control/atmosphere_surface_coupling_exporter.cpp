@@ -306,6 +306,9 @@ void SurfaceCouplingExporter::initialize_impl (const RunType /* run_type */)
   EKAT_REQUIRE_MSG(m_num_scream_exports = m_num_from_file_exports+m_num_const_exports+m_num_from_model_exports,"Error! surface_coupling_exporter - Something went wrong set the type of export for all variables.");
   EKAT_REQUIRE_MSG(m_num_from_model_exports>=0,"Error! surface_coupling_exporter - The number of exports derived from EAMxx < 0, something must have gone wrong in assigning the types of exports for all variables.");
 
+  // Build the table used to fill the cpl buffers
+  create_cpl_export_descs();
+
   // Perform initial export (if any are marked for export during initialization)
   if (any_initial_exports) do_export(0, true);
 }
@@ -317,10 +320,7 @@ void SurfaceCouplingExporter::run_impl (const double dt)
 // =========================================================================================
 void SurfaceCouplingExporter::do_export(const double dt, const bool called_during_initialization)
 {
-  if (m_num_const_exports>0) {
-    set_constant_exports();
-  }
-
+  // NOTE: exports set to a constant are handled directly in do_export_to_cpl
   if (m_num_from_file_exports>0) {
     set_from_file_exports(dt);
   }
@@ -333,23 +333,6 @@ void SurfaceCouplingExporter::do_export(const double dt, const bool called_durin
   do_export_to_cpl(called_during_initialization);
 }
 // =========================================================================================
-void SurfaceCouplingExporter::set_constant_exports()
-{
-  // Cycle through those fields that will be set to a constant value:
-  int num_set = 0; // Checker to make sure we got all the fields we wanted.
-  for (int i=0; i<m_num_scream_exports; ++i) {
-    if (m_export_source_h(i)==CONSTANT) {
-      std::string fname = m_export_field_names[i];
-      const auto field_view = m_helper_fields.at(fname).get_view<Real*>();
-      Kokkos::deep_copy(field_view,m_export_constants.at(fname));
-      num_set++;
-    }
-  }
-  // Gotta catch em all
-  EKAT_REQUIRE_MSG(num_set==m_num_const_exports,"ERROR! SurfaceCouplingExporter::set_constant_exports() - Number of fields set to a constant (" + std::to_string(num_set) +") doesn't match the number recorded at initialization (" + std::to_string(m_num_const_exports) +").  Something went wrong.");
-
-}
-// =========================================================================================
 void SurfaceCouplingExporter::set_from_file_exports(const int dt)
 {
   // Perform interpolation on the data with the latest timestamp
@@ -379,12 +362,6 @@ void SurfaceCouplingExporter::compute_eamxx_exports(const double dt, const bool
   const auto& horiz_winds          = get_field_in("horiz_winds").get_view<const Real***>();
   const auto& p_mid                = get_field_in("p_mid").get_view<const Spack**>();
   const auto& phis                 = get_field_in("phis").get_view<const Real*>();
-  const auto& sfc_flux_dir_nir     = get_field_in("sfc_flux_dir_nir").get_view<const Real*>();
-  const auto& sfc_flux_dir_vis     = get_field_in("sfc_flux_dir_vis").get_view<const Real*>();
-  const auto& sfc_flux_dif_nir     = get_field_in("sfc_flux_dif_nir").get_view<const Real*>();
-  const auto& sfc_flux_dif_vis     = get_field_in("sfc_flux_dif_vis").get_view<const Real*>();
-  const auto& sfc_flux_sw_net      = get_field_in("sfc_flux_sw_net" ).get_view<const Real*>();
-  const auto& sfc_flux_lw_dn       = get_field_in("sfc_flux_lw_dn"  ).get_view<const Real*>();
 
   const auto& precip_liq_surf_mass = get_field_in("precip_liq_surf_mass").get_view<const Real*>();
   const auto& precip_ice_surf_mass = get_field_in("precip_ice_surf_mass").get_view<const Real*>();
@@ -400,12 +377,6 @@ void SurfaceCouplingExporter::compute_eamxx_exports(const double dt, const bool
   const auto Sa_pslv    = m_helper_fields.at("Sa_pslv").get_view<Real*>();
   const auto Faxa_rainl = m_helper_fields.at("Faxa_rainl").get_view<Real*>();
   const auto Faxa_snowl = m_helper_fields.at("Faxa_snowl").get_view<Real*>();
-  const auto Faxa_swndr = m_helper_fields.at("Faxa_swndr").get_view<Real*>();
-  const auto Faxa_swvdr = m_helper_fields.at("Faxa_swvdr").get_view<Real*>();
-  const auto Faxa_swndf = m_helper_fields.at("Faxa_swndf").get_view<Real*>();
-  const auto Faxa_swvdf = m_helper_fields.at("Faxa_swvdf").get_view<Real*>();
-  const auto Faxa_swnet = m_helper_fields.at("Faxa_swnet").get_view<Real*>();
-  const auto Faxa_lwdn  = m_helper_fields.at("Faxa_lwdn" ).get_view<Real*>();
 
   const auto dz    = m_buffer.dz;
   const auto z_int = m_buffer.z_int;
@@ -423,12 +394,6 @@ void SurfaceCouplingExporter::compute_eamxx_exports(const double dt, const bool
   int idx_Sa_pslv    =  8;
   int idx_Faxa_rainl =  9;
   int idx_Faxa_snowl = 10;
-  int idx_Faxa_swndr = 11;
-  int idx_Faxa_swvdr = 12;
-  int idx_Faxa_swndf = 13;
-  int idx_Faxa_swvdf = 14;
-  int idx_Faxa_swnet = 15;
-  int idx_Faxa_lwdn  = 16;
 
 
   // Local copies, to deal with CUDA's handling of *this.
@@ -527,61 +492,96 @@ void SurfaceCouplingExporter::compute_eamxx_exports(const double dt, const bool
       if (export_source(idx_Faxa_snowl)==FROM_MODEL) { Faxa_snowl(i) = precip_ice_surf_mass(i)/dt*(1000.0/PC::RHO_H2O); }
     }
   });
-  // Variables that are already surface vars in the ATM can just be copied directly.
-  if (m_export_source_h(idx_Faxa_swndr)==FROM_MODEL) { Kokkos::deep_copy(Faxa_swndr, sfc_flux_dir_nir); }
-  if (m_export_source_h(idx_Faxa_swvdr)==FROM_MODEL) { Kokkos::deep_copy(Faxa_swvdr, sfc_flux_dir_vis); }
-  if (m_export_source_h(idx_Faxa_swndf)==FROM_MODEL) { Kokkos::deep_copy(Faxa_swndf, sfc_flux_dif_nir); }
-  if (m_export_source_h(idx_Faxa_swvdf)==FROM_MODEL) { Kokkos::deep_copy(Faxa_swvdf, sfc_flux_dif_vis); }
-  if (m_export_source_h(idx_Faxa_swnet)==FROM_MODEL) { Kokkos::deep_copy(Faxa_swnet, sfc_flux_sw_net); }
-  if (m_export_source_h(idx_Faxa_lwdn )==FROM_MODEL) { Kokkos::deep_copy(Faxa_lwdn,  sfc_flux_lw_dn); }
-
+  // NOTE: variables that are already surface vars in the ATM (e.g., Faxa_swndr) are
+  //       exported directly from the input fields (see create_cpl_export_descs).
+}
+// =========================================================================================
+void SurfaceCouplingExporter::create_cpl_export_descs ()
+{
+  // These exports are surface vars already available in the ATM. If they are
+  // derived from the model state, we export straight from the input field,
+  // rather than copying it in a helper field first.
+  const std::map<std::string,std::string> direct_exports = {
+    {"Faxa_swndr", "sfc_flux_dir_nir"},
+    {"Faxa_swvdr", "sfc_flux_dir_vis"},
+    {"Faxa_swndf", "sfc_flux_dif_nir"},
+    {"Faxa_swvdf", "sfc_flux_dif_vis"},
+    {"Faxa_swnet", "sfc_flux_sw_net"},
+    {"Faxa_lwdn",  "sfc_flux_lw_dn"}
+  };
+
+  // Fields in the cpl data that are not exported by EAMxx keep data=nullptr,
+  // and will be set to 0.0
+  m_cpl_export_descs = decltype(m_cpl_export_descs)("cpl_export_descs",m_num_cpl_exports);
+  auto descs_h = Kokkos::create_mirror_view(m_cpl_export_descs);
+  for (int i=0; i<m_num_scream_exports; ++i) {
+    const std::string fname = m_export_field_names[i];
+    const auto& info = m_column_info_h(i);
+    EKAT_REQUIRE_MSG (info.cpl_indx>=0 and info.cpl_indx<m_num_cpl_exports,
+        "Error! surface_coupling_exporter - cpl index out of bounds.\n"
+        "  - field name: " + fname + "\n"
+        "  - cpl index : " + std::to_string(info.cpl_indx) + "\n"
+        "  - num cpl exports: " + std::to_string(m_num_cpl_exports) + "\n");
+
+    auto& d = descs_h(info.cpl_indx);
+    EKAT_REQUIRE_MSG (d.data==nullptr,
+        "Error! surface_coupling_exporter - cpl index " + std::to_string(info.cpl_indx) +
+        " is used by more than one export (" + fname + ").\n");
+
+    d.data       = info.data;
+    d.col_stride = info.col_stride;
+    d.col_offset = info.col_offset;
+    d.constant_multiple = info.constant_multiple;
+    d.transfer_during_initialization = info.transfer_during_initialization;
+
+    if (m_export_source_h(i)==FROM_MODEL and direct_exports.count(fname)==1) {
+      const auto& f = get_field_in(direct_exports.at(fname));
+      d.data = f.get_internal_view_data<const Real>();
+      get_col_info_for_surface_values(f.get_header_ptr(),
+                                      m_vector_components_view(i),
+                                      d.col_offset, d.col_stride);
+    } else if (m_export_source_h(i)==CONSTANT) {
+      d.is_constant    = true;
+      d.constant_value = m_export_constants.at(fname);
+    }
+  }
+  Kokkos::deep_copy(m_cpl_export_descs,descs_h);
 }
 // =========================================================================================
 void SurfaceCouplingExporter::do_export_to_cpl(const bool called_during_initialization)
 {
   using policy_type = KT::RangePolicy;
-  // Any field not exported by scream, or not exported
-  // during initialization, is set to 0.0
-  Kokkos::deep_copy(m_cpl_exports_view_d, 0.0);
+
 #ifdef HAVE_MOAB
-  // Any field not exported by scream, or not exported
-  // during initialization, is set to 0.0
-  Kokkos::deep_copy(m_moab_cpl_exports_view_d, 0.0);
   const auto moab_cpl_exports_view_d = m_moab_cpl_exports_view_d;
 #endif
   const auto cpl_exports_view_d = m_cpl_exports_view_d;
-  const int  num_exports        = m_num_scream_exports;
+  const int  num_cpl_exports    = m_num_cpl_exports;
   const int  num_cols           = m_num_cols;
-  const auto col_info           = m_column_info_d;
-  // Export to cpl data
-  auto export_policy   = policy_type (0,num_exports*num_cols);
-  Kokkos::parallel_for(export_policy, KOKKOS_LAMBDA(const int& i) {
-    const int ifield = i / num_cols;
-    const int icol   = i % num_cols;
-    const auto& info = col_info(ifield);
-    const auto offset = icol*info.col_stride + info.col_offset;
+  const auto descs              = m_cpl_export_descs;
 
-    // if this is during initialization, check whether or not the field should be exported
-    bool do_export = (not called_during_initialization || info.transfer_during_initialization);
-    if (do_export) {
-      cpl_exports_view_d(icol,info.cpl_indx) = info.constant_multiple*info.data[offset];
-    }
-  });
-#ifdef HAVE_MOAB
+  // Fill all entries of the cpl data in one pass. Any field not exported
+  // by scream, or not exported during initialization, is set to 0.0
+  auto export_policy   = policy_type (0,num_cpl_exports*num_cols);
   Kokkos::parallel_for(export_policy, KOKKOS_LAMBDA(const int& i) {
-    const int ifield = i / num_cols;
-    const int icol   = i % num_cols;
-    const auto& info = col_info(ifield);
-    const auto offset = icol*info.col_stride + info.col_offset;
+    const int icol = i / num_cpl_exports;
+    const int icpl = i % num_cpl_exports;
+    const auto& d = descs(icpl);
 
     // if this is during initialization, check whether or not the field should be exported
-    bool do_export = (not called_during_initialization || info.transfer_during_initialization);
+    Real val = 0;
+    bool do_export = d.data!=nullptr and (not called_during_initialization || d.transfer_during_initialization);
     if (do_export) {
-      moab_cpl_exports_view_d(info.cpl_indx, icol) = info.constant_multiple*info.data[offset];
+      val = d.constant_multiple*(d.is_constant ? d.constant_value : d.data[icol*d.col_stride + d.col_offset]);
     }
-  });
+    cpl_exports_view_d(icol,icpl) = val;
+#ifdef HAVE_MOAB
+    moab_cpl_exports_view_d(icpl,icol) = val;
 #endif
-  // Deep copy fields from device to cpl host array
+  });
+
+  // Deep copy fields from device to cpl host array. If the device shares
+  // memory with the host, the cpl views are the same and this is a no-op.
   Kokkos::deep_copy(m_cpl_exports_view_h,m_cpl_exports_view_d);
 #ifdef HAVE_MOAB
   // Deep copy fields from device to cpl host array
@@ -80,10 +80,24 @@ public:
   // which do not have valid entries.
   void do_export(const double dt, const bool called_during_initialization=false);             // Main export routine
   void compute_eamxx_exports(const double dt, const bool called_during_initialization=false); // Export vars are derived from eamxx state
-  void set_constant_exports();                                                                // Export vars are set to a constant
   void set_from_file_exports(const int dt);                                                   // Export vars are set by interpolation of data from files
   void do_export_to_cpl(const bool called_during_initialization=false);                       // Finish export by copying data to cpl structures.
 
+  // A device-friendly description of how to fill one cpl export field.
+  // There is one entry for each cpl field (not only the ones exported by EAMxx),
+  // so that a single kernel can fill (or zero out) the whole cpl buffers.
+  struct CplExportDesc {
+    // Pointer to the data to export (nullptr if the cpl field is not exported by EAMxx)
+    const Real* data = nullptr;
+    int  col_stride  = 0;
+    int  col_offset  = 0;
+    Real constant_multiple = 0;
+    // If is_constant=true, export constant_multiple*constant_value, and ignore data
+    bool is_constant = false;
+    Real constant_value = 0;
+    bool transfer_during_initialization = false;
+  };
+
   // Take and store data from SCDataManager
   void setup_surface_coupling_data(const SCDataManager &sc_data_manager);
 protected:
@@ -108,6 +122,9 @@ protected:
   // the ATMBufferManager
   void init_buffers(const ATMBufferManager &buffer_manager);
 
+  // Build the device table of cpl export descriptors
+  void create_cpl_export_descs ();
+
   std::shared_ptr<const AbstractGrid> m_grid;
 
   // Keep track of field dimensions and the iteration count
@@ -162,6 +179,9 @@ protected:
   view_1d<DefaultDevice, SurfaceCouplingColumnInfo> m_column_info_d;
   decltype(m_column_info_d)::HostMirror             m_column_info_h;
 
+  // Description of each cpl export field, used by do_export_to_cpl
+  view_1d<DefaultDevice, CplExportDesc>             m_cpl_export_descs;
+
 }; // class SurfaceCouplingExporter
 
 } // namespace scream
@@ -151,123 +151,95 @@ void SurfaceCouplingImporter::run_impl (const double /* dt */)
 void SurfaceCouplingImporter::do_import(const bool called_during_initialization)
 {
   using policy_type = KokkosTypes<DefaultDevice>::RangePolicy;
+  using view_0d     = Field::get_view_type<const Real,Device>;
+  using C           = physics::Constants<Real>;
+
+  static constexpr Real latvap = C::LatVap;
+  static constexpr Real stebol = C::stebol;
+
+  // For IOP cases, some imports may be overwritten with data from the IOP file.
+  // The IOP fields are read directly on device, so no host sync is needed.
+  const bool iop_srf_prop = m_iop and m_iop->get_params().get<bool>("iop_srf_prop");
+  view_0d lhflx, shflx, Tg;
+  if (iop_srf_prop) {
+    if (m_iop_import_source.size()==0) {
+      setup_iop_imports();
+    }
+    if (m_iop->has_iop_field("lhflx")) lhflx = m_iop->get_iop_field("lhflx").get_view<const Real>();
+    if (m_iop->has_iop_field("shflx")) shflx = m_iop->get_iop_field("shflx").get_view<const Real>();
+    if (m_iop->has_iop_field("Tg"))    Tg    = m_iop->get_iop_field("Tg").get_view<const Real>();
+  }
 
   // Local copies, to deal with CUDA's handling of *this
   const auto col_info           = m_column_info_d;
-  const auto cpl_imports_view_d = m_cpl_imports_view_d;
+  const auto iop_source         = m_iop_import_source;
   const int  num_cols           = m_num_cols;
   const int  num_imports        = m_num_scream_imports;
 
-  // Deep copy cpl host array to devic
-  Kokkos::deep_copy(m_cpl_imports_view_d,m_cpl_imports_view_h);
+  // Deep copy cpl host array to device. If MOAB is enabled, the MOAB data
+  // is the one that gets imported, so we only need that one.
 #ifdef HAVE_MOAB
-  // Deep copy cpl host array to device
   const auto moab_cpl_imports_view_d = m_moab_cpl_imports_view_d;
   Kokkos::deep_copy(m_moab_cpl_imports_view_d,m_moab_cpl_imports_view_h);
+#else
+  const auto cpl_imports_view_d = m_cpl_imports_view_d;
+  Kokkos::deep_copy(m_cpl_imports_view_d,m_cpl_imports_view_h);
 #endif
 
-
   // Unpack the fields
   auto unpack_policy = policy_type(0,num_imports*num_cols);
   Kokkos::parallel_for(unpack_policy, KOKKOS_LAMBDA(const int& i) {
-    const int ifield = i / num_cols;
-    const int icol   = i % num_cols;
-
-    const auto& info = col_info(ifield);
-
-    auto offset = icol*info.col_stride + info.col_offset;
-
-    // if this is during initialization, check whether or not the field should be imported
-    bool do_import = (not called_during_initialization || info.transfer_during_initialization);
-    if (do_import) {
-      info.data[offset] = cpl_imports_view_d(icol,info.cpl_indx)*info.constant_multiple;
-    }
-  });
-
-#ifdef HAVE_MOAB
-  Kokkos::parallel_for(unpack_policy, KOKKOS_LAMBDA(const int& i) {
-
     const int icol   = i / num_imports;
     const int ifield = i % num_imports;
 
     const auto& info = col_info(ifield);
 
-    auto offset = icol*info.col_stride + info.col_offset;
-
     // if this is during initialization, check whether or not the field should be imported
     bool do_import = (not called_during_initialization || info.transfer_during_initialization);
-    if (do_import) {
-      info.data[offset] = moab_cpl_imports_view_d(info.cpl_indx, icol)*info.constant_multiple;
+    if (not do_import) {
+      return;
     }
-  });
-#endif
 
-  if (m_iop) {
-    if (m_iop->get_params().get<bool>("iop_srf_prop")) {
-      // Overwrite imports with data from IOP file
-      overwrite_iop_imports(called_during_initialization);
+    const auto offset = icol*info.col_stride + info.col_offset;
+    const int src = iop_srf_prop ? iop_source(ifield) : IOP_NONE;
+    switch (src) {
+      case IOP_LHFLX: info.data[offset] = lhflx()/latvap;                     break;
+      case IOP_SHFLX: info.data[offset] = shflx();                            break;
+      case IOP_TG:    info.data[offset] = Tg();                               break;
+      case IOP_TG4:   info.data[offset] = stebol*Tg()*Tg()*Tg()*Tg();         break;
+      default:
+#ifdef HAVE_MOAB
+        info.data[offset] = moab_cpl_imports_view_d(info.cpl_indx, icol)*info.constant_multiple;
+#else
+        info.data[offset] = cpl_imports_view_d(icol,info.cpl_indx)*info.constant_multiple;
+#endif
     }
-  }
+  });
 }
 // =========================================================================================
-void SurfaceCouplingImporter::overwrite_iop_imports (const bool called_during_initialization)
+void SurfaceCouplingImporter::setup_iop_imports ()
 {
-  using policy_type = KokkosTypes<DefaultDevice>::RangePolicy;
-  using C = physics::Constants<Real>;
-
   const auto has_lhflx = m_iop->has_iop_field("lhflx");
   const auto has_shflx = m_iop->has_iop_field("shflx");
   const auto has_Tg    = m_iop->has_iop_field("Tg");
 
-  static constexpr Real latvap = C::LatVap;
-  static constexpr Real stebol = C::stebol;
-
-  const auto& col_info_h = m_column_info_h;
-  const auto& col_info_d = m_column_info_d;
-
+  m_iop_import_source = decltype(m_iop_import_source)("iop_import_source",m_num_scream_imports);
+  auto iop_source_h = Kokkos::create_mirror_view(m_iop_import_source);
   for (int ifield=0; ifield<m_num_scream_imports; ++ifield) {
     const std::string fname = m_import_field_names[ifield];
-    const auto& info_h = col_info_h(ifield);
-
-    // If we are in initialization and field should not be imported, skip
-    if (called_during_initialization && not info_h.transfer_during_initialization) {
-      continue;
-    }
-
-    // Store IOP surf data into col_val
-    Real col_val(std::nan(""));
     if (fname == "surf_evap" && has_lhflx) {
-      const auto f = m_iop->get_iop_field("lhflx");
-      f.sync_to_host();
-      col_val = f.get_view<Real, Host>()()/latvap;
+      iop_source_h(ifield) = IOP_LHFLX;
     } else if (fname == "surf_sens_flux" && has_shflx) {
-      const auto f = m_iop->get_iop_field("shflx");
-      f.sync_to_host();
-      col_val = f.get_view<Real, Host>()();
+      iop_source_h(ifield) = IOP_SHFLX;
     } else if (fname == "surf_radiative_T" && has_Tg) {
-      const auto f = m_iop->get_iop_field("Tg");
-      f.sync_to_host();
-      col_val = f.get_view<Real, Host>()();
+      iop_source_h(ifield) = IOP_TG;
     } else if (fname == "surf_lw_flux_up" && has_Tg) {
-      const auto f = m_iop->get_iop_field("Tg");
-      f.sync_to_host();
-      col_val = stebol*std::pow(f.get_view<Real, Host>()(), 4);
+      iop_source_h(ifield) = IOP_TG4;
     } else {
-      // If import field doesn't satisify above, skip
-      continue;
+      iop_source_h(ifield) = IOP_NONE;
     }
-
-    // Overwrite iop imports with col_val for each column
-    auto policy = policy_type(0, m_num_cols);
-    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const int& icol) {
-      const auto& info_d = col_info_d(ifield);
-      const auto offset = icol*info_d.col_stride + info_d.col_offset;
-      info_d.data[offset] = col_val;
-#ifdef HAVE_MOAB
-   //  TODO
-#endif
-    });
   }
+  Kokkos::deep_copy(m_iop_import_source,iop_source_h);
 }
 // =========================================================================================
 void SurfaceCouplingImporter::finalize_impl()
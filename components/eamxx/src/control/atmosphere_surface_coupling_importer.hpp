@@ -58,11 +58,22 @@ public:
   // Take and store data from SCDataManager
   void setup_surface_coupling_data(const SCDataManager &sc_data_manager);
 
-  // Overwrite imports for IOP cases with IOP file surface data
-  void overwrite_iop_imports (const bool called_during_initialization);
-
 protected:
 
+  // For IOP cases with iop_srf_prop=true, some imports are overwritten with
+  // the (column-independent) surface data from the IOP file. This enum
+  // tells which IOP quantity (if any) is used for each import.
+  enum IOPImportSource : int {
+    IOP_NONE  = 0,  // Import from cpl data
+    IOP_LHFLX = 1,  // lhflx/latvap
+    IOP_SHFLX = 2,  // shflx
+    IOP_TG    = 3,  // Tg
+    IOP_TG4   = 4   // stebol*Tg^4
+  };
+
+  // Set the IOP source of each import (done once, the first time it's needed)
+  void setup_iop_imports ();
+
   // The three main overrides for the subcomponent
   void initialize_impl (const RunType run_type);
   void run_impl        (const double dt);
@@ -104,6 +115,9 @@ protected:
   view_1d<DefaultDevice, SurfaceCouplingColumnInfo> m_column_info_d;
   decltype(m_column_info_d)::HostMirror             m_column_info_h;
 
+  // IOP source for each import (see IOPImportSource)
+  view_1d<DefaultDevice, int> m_iop_import_source;
+
   // The grid is needed for property checks
   std::shared_ptr<const AbstractGrid> m_grid;
 }; // class SurfaceCouplingImporter
@@ -298,31 +298,20 @@ void MAMAci::initialize_impl(const RunType run_type) {
   dry_atm_.p_del  = get_field_in("pseudo_density").get_view<const Real **>();
   dry_atm_.omega  = get_field_in("omega").get_view<const Real **>();
 
-  // store fields converted to dry mmr from wet mmr in dry_atm_
-  dry_atm_.qv = buffer_.qv_dry;
-  dry_atm_.qc = buffer_.qc_dry;
-  dry_atm_.nc = buffer_.nc_dry;
-  dry_atm_.qi = buffer_.qi_dry;
-  dry_atm_.ni = buffer_.ni_dry;
+  // dry mixing ratios of water species, layer heights and updraft velocity
+  // are shared among MAM processes, and only recomputed if the state changed
+  for (const auto& name : mam_coupling::DryAtmCache::input_field_names()) {
+    dry_atm_cache_inputs_.push_back(get_field_in(name));
+  }
+  dry_atm_cache_ = mam_coupling::DryAtmCache::get(grid_->name(), ncol_, nlev_, dry_atm_cache_inputs_);
+  dry_atm_cache_->set_views(dry_atm_);
 
   // pbl_height
   dry_atm_.pblh = get_field_in("pbl_height").get_view<const Real *>();
 
-  // geometric thickness of layers (m)
-  dry_atm_.dz = buffer_.dz;
-
-  // geopotential height above surface at interface levels (m)
-  dry_atm_.z_iface = buffer_.z_iface;
-
-  // geopotential height above surface at mid levels (m)
-  dry_atm_.z_mid = buffer_.z_mid;
-
   // total cloud fraction
   dry_atm_.cldfrac = get_field_in("cldfrac_tot").get_view<const Real **>();
 
-  // computed updraft velocity
-  dry_atm_.w_updraft = buffer_.w_updraft;
-
   // ------------------------------------------------------------------------
   // Output fields to be used by other processes
   // ------------------------------------------------------------------------
@@ -539,8 +528,10 @@ void MAMAci::run_impl(const double dt) {
   const auto scan_policy = ekat::ExeSpaceUtils<
       KT::ExeSpace>::get_thread_range_parallel_scan_team_policy(ncol_, nlev_);
 
-  // preprocess input -- needs a scan for the calculation of local derivied
-  // quantities
+  // dry atm state (only recomputed if another process changed the wet state)
+  dry_atm_cache_->update(wet_atm_, dry_atm_, dry_atm_cache_inputs_);
+
+  // preprocess input
   Kokkos::parallel_for("preprocess", scan_policy, preprocess_);
   Kokkos::fence();
 
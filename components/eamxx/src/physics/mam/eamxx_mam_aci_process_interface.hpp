@@ -66,6 +66,10 @@ class MAMAci final : public scream::AtmosphereProcess {
   // dry mixing ratios (water species)
   mam_coupling::DryAtmosphere dry_atm_;
 
+  // dry atm quantities shared by all MAM processes, and the fields they depend on
+  std::shared_ptr<mam_coupling::DryAtmCache> dry_atm_cache_;
+  std::vector<Field> dry_atm_cache_inputs_;
+
   // aerosol dry diameter
   const_view_3d dgnum_;
 
@@ -204,14 +208,9 @@ class MAMAci final : public scream::AtmosphereProcess {
         const Kokkos::TeamPolicy<KT::ExeSpace>::member_type &team) const {
       const int i = team.league_rank();  // column index
 
-      compute_dry_mixing_ratios(team, wet_atm_pre_, dry_atm_pre_, i);
+      // NOTE: dry atm quantities are computed by mam_coupling::DryAtmCache
       compute_dry_mixing_ratios(team, wet_atm_pre_, wet_aero_pre_,
                                 dry_aero_pre_, i);
-      team.team_barrier();
-      // vertical heights has to be computed after computing dry mixing ratios
-      // for atmosphere
-      compute_vertical_layer_heights(team, dry_atm_pre_, i);
-      compute_updraft_velocities(team, wet_atm_pre_, dry_atm_pre_, i);
     }  // operator()
 
     // local variables for preprocess struct
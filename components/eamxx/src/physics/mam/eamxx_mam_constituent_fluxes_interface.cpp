@@ -194,16 +194,13 @@ void MAMConstituentFluxes::initialize_impl(const RunType run_type) {
   dry_atm_.omega   = get_field_in("omega").get_view<const Real **>();
   dry_atm_.p_del   = get_field_in("pseudo_density").get_view<const Real **>();
 
-  // store fields converted to dry mmr from wet mmr in dry_atm_
-  dry_atm_.z_mid     = buffer_.z_mid;
-  dry_atm_.z_iface   = buffer_.z_iface;
-  dry_atm_.dz        = buffer_.dz;
-  dry_atm_.qv        = buffer_.qv_dry;
-  dry_atm_.qc        = buffer_.qc_dry;
-  dry_atm_.nc        = buffer_.nc_dry;
-  dry_atm_.qi        = buffer_.qi_dry;
-  dry_atm_.ni        = buffer_.ni_dry;
-  dry_atm_.w_updraft = buffer_.w_updraft;
+  // dry mixing ratios of water species, layer heights and updraft velocity
+  // are shared among MAM processes, and only recomputed if the state changed
+  for (const auto& name : mam_coupling::DryAtmCache::input_field_names()) {
+    dry_atm_cache_inputs_.push_back(get_field_in(name));
+  }
+  dry_atm_cache_ = mam_coupling::DryAtmCache::get(grid_->name(), ncol_, nlev_, dry_atm_cache_inputs_);
+  dry_atm_cache_->set_views(dry_atm_);
   dry_atm_.z_surf    = 0.0;  // FIXME: for now
 
   // Constituent fluxes at the surface (gasses and aerosols) [kg/m2/s]
@@ -271,32 +268,9 @@ void MAMConstituentFluxes::run_impl(const double dt) {
   // Compute vertical layer heights and updraft velocity. We need these to fully
   // populate dry_atm_, so that we can form a HAERO atmosphere object. HAERO
   // atmosphere object is used to for state%q like array.
-  // NOTE: We cannot pass a member of the interface class (in this case, MAMConstituentFluxes)
-  // inside a parallel_for. Instead, we must create a soft copy of each member.
-  const auto & wet_atm = wet_atm_;
-  const auto & dry_atm= dry_atm_;
-
-  auto lambda =
-      KOKKOS_LAMBDA(const Kokkos::TeamPolicy<KT::ExeSpace>::member_type &team) {
-    const int icol = team.league_rank();       // column index
-    compute_dry_mixing_ratios(team, wet_atm,  // in
-                              dry_atm,        // out
-                              icol);           // in
-    team.team_barrier();
-    // vertical heights has to be computed after computing dry mixing ratios
-    // for atmosphere
-    compute_vertical_layer_heights(team,        // in
-                                   dry_atm,    // out
-                                   icol);       // in
-    compute_updraft_velocities(team, wet_atm,  // in
-                               dry_atm,        // out
-                               icol);           // in
-  };
-  // policy
-  const auto scan_policy = ekat::ExeSpaceUtils<
-      KT::ExeSpace>::get_thread_range_parallel_scan_team_policy(ncol_, nlev_);
-
-  Kokkos::parallel_for("mam_cfi_compute_updraft", scan_policy, lambda);
+  // These are shared with the other MAM processes, and only recomputed if
+  // another process changed the wet state.
+  dry_atm_cache_->update(wet_atm_, dry_atm_, dry_atm_cache_inputs_);
 
   update_gas_aerosols_using_constituents(ncol_, nlev_, dt, dry_atm_,
                                          constituent_fluxes_,
@@ -26,6 +26,10 @@ class MAMConstituentFluxes final : public scream::AtmosphereProcess {
   mam_coupling::WetAtmosphere wet_atm_;
   mam_coupling::DryAtmosphere dry_atm_;
 
+  // dry atm quantities shared by all MAM processes, and the fields they depend on
+  std::shared_ptr<mam_coupling::DryAtmCache> dry_atm_cache_;
+  std::vector<Field> dry_atm_cache_inputs_;
+
   // aerosol state variables
   mam_coupling::AerosolState wet_aero_;
 
@@ -398,15 +398,13 @@ void MAMMicrophysics::initialize_impl(const RunType run_type) {
   dry_atm_.pblh      = get_field_in("pbl_height").get_view<const Real *>();
   dry_atm_.phis      = get_field_in("phis").get_view<const Real *>();
   dry_atm_.omega     = get_field_in("omega").get_view<const Real **>();
-  dry_atm_.z_mid     = buffer_.z_mid;
-  dry_atm_.dz        = buffer_.dz;
-  dry_atm_.z_iface   = buffer_.z_iface;
-  dry_atm_.qv        = buffer_.qv_dry;
-  dry_atm_.qc        = buffer_.qc_dry;
-  dry_atm_.nc        = buffer_.nc_dry;
-  dry_atm_.qi        = buffer_.qi_dry;
-  dry_atm_.ni        = buffer_.ni_dry;
-  dry_atm_.w_updraft = buffer_.w_updraft;
+  // dry mixing ratios of water species, layer heights and updraft velocity
+  // are shared among MAM processes, and only recomputed if the state changed
+  for (const auto& name : mam_coupling::DryAtmCache::input_field_names()) {
+    dry_atm_cache_inputs_.push_back(get_field_in(name));
+  }
+  dry_atm_cache_ = mam_coupling::DryAtmCache::get(grid_->name(), ncol_, nlev_, dry_atm_cache_inputs_);
+  dry_atm_cache_->set_views(dry_atm_);
   dry_atm_.z_surf    = 0.0;  // It is always zero.
 
   // get surface albedo: shortwave, direct
@@ -545,13 +543,19 @@ void MAMMicrophysics::initialize_impl(const RunType run_type) {
 //  RUN_IMPL
 // ================================================================
 void MAMMicrophysics::run_impl(const double dt) {
-  const auto scan_policy = ekat::ExeSpaceUtils<
-      KT::ExeSpace>::get_thread_range_parallel_scan_team_policy(ncol_, nlev_);
   const auto policy =
       ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(ncol_, nlev_);
+  // pointwise work is flattened over (column, level), so that all levels of
+  // all columns are exposed to threads/vector lanes at once
+  const auto pointwise_policy =
+      Kokkos::MDRangePolicy<KT::ExeSpace, Kokkos::Rank<2>, PointwiseTag>(
+          {0, 0}, {ncol_, nlev_});
+
+  // dry atm state (only recomputed if another process changed the wet state)
+  dry_atm_cache_->update(wet_atm_, dry_atm_, dry_atm_cache_inputs_);
 
-  // preprocess input -- needs a scan for the calculation of atm height
-  Kokkos::parallel_for("preprocess", scan_policy, preprocess_);
+  // preprocess input -- wet->dry conversions of aerosols are pointwise
+  Kokkos::parallel_for("preprocess_pointwise", pointwise_policy, preprocess_);
   Kokkos::fence();
 
   const auto wet_geometric_mean_diameter_i =
@@ -723,8 +727,14 @@ void MAMMicrophysics::run_impl(const double dt) {
     permute_4[i]             = mam4::gas_chemistry::permute_4[i];
   }
   // loop over atmosphere columns and compute aerosol microphyscs
+  // NOTE: unlike the pre/postprocessing, this is still one team per column.
+  //       The chemistry and the implicit solver are inside
+  //       perform_atmospheric_chemistry_and_microphysics (mam4xx), which takes
+  //       a whole column, and only parallelizes over levels within the team.
+  //       Flattening them over (column, level) requires changes in mam4xx.
   Kokkos::parallel_for(
-      policy, KOKKOS_LAMBDA(const ThreadTeam &team) {
+      "mam_microphysics_chemistry", policy,
+      KOKKOS_LAMBDA(const ThreadTeam &team) {
         const int icol     = team.league_rank();   // column index
         const Real col_lat = col_latitudes(icol);  // column latitude (degrees?)
 
@@ -805,7 +815,7 @@ void MAMMicrophysics::run_impl(const double dt) {
   Kokkos::fence();
 
   // postprocess output
-  Kokkos::parallel_for("postprocess", policy, postprocess_);
+  Kokkos::parallel_for("postprocess", pointwise_policy, postprocess_);
   Kokkos::fence();
 
 }  // MAMMicrophysics::run_impl
@@ -94,6 +94,10 @@ class MAMMicrophysics final : public scream::AtmosphereProcess {
   };
   Config config_;
 
+  // Tag for the pointwise parts of pre/postprocessing, which are dispatched
+  // over a flattened (column, level) range rather than one team per column
+  struct PointwiseTag {};
+
   // Atmosphere processes often have a pre-processing step that constructs
   // required variables from the set of fields stored in the field manager.
   // This functor implements this step, which is called during run_impl.
@@ -114,18 +118,12 @@ class MAMMicrophysics final : public scream::AtmosphereProcess {
       dry_aero_pre_ = dry_aero;
     }
 
+    // pointwise wet->dry conversions, for column i and level k
+    // NOTE: dry atm quantities are computed by mam_coupling::DryAtmCache
     KOKKOS_INLINE_FUNCTION
-    void operator()(
-        const Kokkos::TeamPolicy<KT::ExeSpace>::member_type &team) const {
-      const int i = team.league_rank();  // column index
-
-      compute_dry_mixing_ratios(team, wet_atm_pre_, dry_atm_pre_, i);
-      compute_dry_mixing_ratios(team, wet_atm_pre_, wet_aero_pre_,
-                                dry_aero_pre_, i);
-      team.team_barrier();
-
-      compute_vertical_layer_heights(team, dry_atm_pre_, i);
-      compute_updraft_velocities(team, wet_atm_pre_, dry_atm_pre_, i);
+    void operator()(const PointwiseTag &, const int i, const int k) const {
+      compute_dry_mixing_ratios(wet_atm_pre_, wet_aero_pre_, dry_aero_pre_, i,
+                                k);
     }  // operator()
 
     // number of horizontal columns and vertical levels
@@ -156,13 +154,11 @@ class MAMMicrophysics final : public scream::AtmosphereProcess {
       dry_aero_post_ = dry_aero;
     }
 
+    // pointwise dry->wet conversions, for column i and level k
     KOKKOS_INLINE_FUNCTION
-    void operator()(
-        const Kokkos::TeamPolicy<KT::ExeSpace>::member_type &team) const {
-      const int i = team.league_rank();  // column index
-      compute_wet_mixing_ratios(team, dry_atm_post_, dry_aero_post_,
-                                wet_aero_post_, i);
-      team.team_barrier();
+    void operator()(const PointwiseTag &, const int i, const int k) const {
+      compute_wet_mixing_ratios(dry_atm_post_, dry_aero_post_, wet_aero_post_,
+                                i, k);
     }  // operator()
 
     // number of horizontal columns and vertical levels
@@ -184,6 +180,10 @@ class MAMMicrophysics final : public scream::AtmosphereProcess {
   // atmospheric and aerosol state variables
   mam_coupling::WetAtmosphere wet_atm_;
   mam_coupling::DryAtmosphere dry_atm_;
+
+  // dry atm quantities shared by all MAM processes, and the fields they depend on
+  std::shared_ptr<mam_coupling::DryAtmCache> dry_atm_cache_;
+  std::vector<Field> dry_atm_cache_inputs_;
   mam_coupling::AerosolState wet_aero_, dry_aero_;
 
   // photolysis rate table (column-independent)
@@ -154,16 +154,14 @@ void MAMOptics::initialize_impl(const RunType run_type) {
   dry_atm_.pblh = get_field_in("pbl_height").get_view<const Real *>();
   dry_atm_.phis = get_field_in("phis").get_view<const Real *>();
   dry_atm_.omega = get_field_in("omega").get_view<const Real **>();
+  // dry mixing ratios of water species, layer heights and updraft velocity
+  // are shared among MAM processes, and only recomputed if the state changed
+  for (const auto& name : mam_coupling::DryAtmCache::input_field_names()) {
+    dry_atm_cache_inputs_.push_back(get_field_in(name));
+  }
+  dry_atm_cache_ = mam_coupling::DryAtmCache::get(grid_->name(), ncol_, nlev_, dry_atm_cache_inputs_);
+  dry_atm_cache_->set_views(dry_atm_);
 
-  dry_atm_.z_mid     = buffer_.z_mid;
-  dry_atm_.dz        = buffer_.dz;
-  dry_atm_.z_iface   = buffer_.z_iface;
-  dry_atm_.qv        = buffer_.qv_dry;
-  dry_atm_.qc        = buffer_.qc_dry;
-  dry_atm_.nc        = buffer_.nc_dry;
-  dry_atm_.qi        = buffer_.qi_dry;
-  dry_atm_.ni        = buffer_.ni_dry;
-  dry_atm_.w_updraft = buffer_.w_updraft;
   // The surface height is zero by definition.
   // see eam/src/physics/cam/geopotential.F90
   dry_atm_.z_surf    = 0.0;
@@ -364,7 +362,10 @@ void MAMOptics::run_impl(const double dt) {
   const auto scan_policy = ekat::ExeSpaceUtils<
       KT::ExeSpace>::get_thread_range_parallel_scan_team_policy(ncol_, nlev_);
 
-  // preprocess input -- needs a scan for the calculation of atm height
+  // dry atm state (only recomputed if another process changed the wet state)
+  dry_atm_cache_->update(wet_atm_, dry_atm_, dry_atm_cache_inputs_);
+
+  // preprocess input
   Kokkos::parallel_for("preprocess", scan_policy, preprocess_);
   Kokkos::fence();
 
@@ -89,13 +89,8 @@ class MAMOptics final : public scream::AtmosphereProcess {
     void operator()(
         const Kokkos::TeamPolicy<KT::ExeSpace>::member_type &team) const {
       const int i = team.league_rank();  // column index
-      // first, compute dry fields
-      compute_dry_mixing_ratios(team, wet_atm_, dry_atm_, i);
+      // NOTE: dry atm quantities are computed by mam_coupling::DryAtmCache
       compute_dry_mixing_ratios(team, wet_atm_, wet_aero_, dry_aero_, i);
-      team.team_barrier();
-      // second, we can use dry fields to compute dz, zmin, zint
-      compute_vertical_layer_heights(team, dry_atm_, i);
-      compute_updraft_velocities(team, wet_atm_, dry_atm_, i);
     }  // operator()
 
     // number of horizontal columns and vertical levels
@@ -165,6 +160,10 @@ class MAMOptics final : public scream::AtmosphereProcess {
   // atmospheric and aerosol state variables
   mam_coupling::WetAtmosphere wet_atm_;
   mam_coupling::DryAtmosphere dry_atm_;
+
+  // dry atm quantities shared by all MAM processes, and the fields they depend on
+  std::shared_ptr<mam_coupling::DryAtmCache> dry_atm_cache_;
+  std::vector<Field> dry_atm_cache_inputs_;
   mam_coupling::AerosolState wet_aero_, dry_aero_;
 
   mam_coupling::view_3d ssa_cmip6_sw_, af_cmip6_sw_, ext_cmip6_sw_;
@@ -82,16 +82,10 @@ class MAMWetscav : public scream::AtmosphereProcess {
     void operator()(
         const Kokkos::TeamPolicy<KT::ExeSpace>::member_type &team) const {
       const int i = team.league_rank();  // column index
-      // first, compute dry fields
-      compute_dry_mixing_ratios(team, wet_atm_pre_, dry_atm_pre_, i);
+      // NOTE: dry atm quantities are computed by mam_coupling::DryAtmCache
       compute_dry_mixing_ratios(team, wet_atm_pre_, wet_aero_pre_,
                                 dry_aero_pre_, i);
       team.team_barrier();
-      // second, we can use dry fields to compute dz, zmin, zint
-      compute_vertical_layer_heights(team, dry_atm_pre_, i);
-      compute_updraft_velocities(team, wet_atm_pre_, dry_atm_pre_, i);
-      // allows kernels below to use layer heights operator()
-      team.team_barrier();
     }
 
     // Number of horizontal columns and vertical levels
@@ -157,6 +151,10 @@ class MAMWetscav : public scream::AtmosphereProcess {
   mam_coupling::WetAtmosphere wet_atm_;
   mam_coupling::DryAtmosphere dry_atm_;
 
+  // dry atm quantities shared by all MAM processes, and the fields they depend on
+  std::shared_ptr<mam_coupling::DryAtmCache> dry_atm_cache_;
+  std::vector<Field> dry_atm_cache_inputs_;
+
   // Work arrays
   view_2d work_;
 
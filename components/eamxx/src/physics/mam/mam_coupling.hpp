@@ -4,9 +4,15 @@
 #include <mam4xx/mam4.hpp>
 #include <mam4xx/conversions.hpp>
 #include <ekat/kokkos/ekat_subview_utils.hpp>
+#include <ekat/kokkos/ekat_kokkos_utils.hpp>
 #include <share/atm_process/ATMBufferManager.hpp>
+#include <share/field/field.hpp>
 #include <share/util/scream_common_physics_functions.hpp>
 
+#include <map>
+#include <memory>
+#include <vector>
+
 // These data structures and functions are used to move data between EAMxx
 // and mam4xx. This file must be adjusted whenever the aerosol modes and
 // species are modified.
@@ -314,21 +320,12 @@ struct Buffer {
   static constexpr int num_2d_scratch = 10;
 
   // number of local fields stored at column midpoints
-  static constexpr int num_2d_mid = 8 + // number of dry atm fields
-                                    2 * (num_aero_modes() + num_aero_tracers()) +
+  // NOTE: the dry atmospheric state is stored in DryAtmCache, since it is
+  //       shared among MAM processes.
+  static constexpr int num_2d_mid = 2 * (num_aero_modes() + num_aero_tracers()) +
                                     num_aero_gases() +
                                     num_2d_scratch;
 
-  // (dry) atmospheric state
-  uview_2d z_mid;     // height at midpoints
-  uview_2d dz;        // layer thickness
-  uview_2d qv_dry;    // dry water vapor mixing ratio (dry air)
-  uview_2d qc_dry;    // dry cloud water mass mixing ratio
-  uview_2d nc_dry;    // dry cloud water number mixing ratio
-  uview_2d qi_dry;    // cloud ice mass mixing ratio
-  uview_2d ni_dry;    // dry cloud ice number mixing ratio
-  uview_2d w_updraft; // vertical wind velocity
-
   // aerosol dry interstitial/cloudborne number/mass mixing ratios
   // (because the number of species per mode varies, not all of these will
   //  be used)
@@ -343,15 +340,6 @@ struct Buffer {
   // undedicated scratch fields for process-specific data
   uview_2d scratch[num_2d_scratch];
 
-  // =======================
-  // column interface fields
-  // =======================
-
-  // number of local fields stored at column interfaces
-  static constexpr int num_2d_iface = 1;
-
-  uview_2d z_iface; // height at interfaces
-
   // storage
   Real* wsm_data;
 };
@@ -359,9 +347,7 @@ struct Buffer {
 // ON HOST, returns the number of bytes of device memory needed by the above
 // Buffer type given the number of columns and vertical levels
 inline size_t buffer_size(const int ncol, const int nlev) {
-  return sizeof(Real) *
-    (Buffer::num_2d_mid * ncol * nlev +
-     Buffer::num_2d_iface * ncol * (nlev+1));
+  return sizeof(Real) * Buffer::num_2d_mid * ncol * nlev;
 }
 
 // ON HOST, initializeѕ the Buffer type with sufficient memory to store
@@ -374,15 +360,6 @@ inline size_t init_buffer(const ATMBufferManager &buffer_manager,
 
   // set view pointers for midpoint fields
   uview_2d* view_2d_mid_ptrs[Buffer::num_2d_mid] = {
-    &buffer.z_mid,
-    &buffer.dz,
-    &buffer.qv_dry,
-    &buffer.qc_dry,
-    &buffer.nc_dry,
-    &buffer.qi_dry,
-    &buffer.ni_dry,
-    &buffer.w_updraft,
-
     // aerosol modes
     &buffer.dry_int_aero_nmr[0],
     &buffer.dry_int_aero_nmr[1],
@@ -463,15 +440,6 @@ inline size_t init_buffer(const ATMBufferManager &buffer_manager,
     mem += view_2d_mid_ptrs[i]->size();
   }
 
-  // set view pointers for interface fields
-  uview_2d* view_2d_iface_ptrs[Buffer::num_2d_iface] = {
-    &buffer.z_iface
-  };
-  for (int i = 0; i < Buffer::num_2d_iface; ++i) {
-    *view_2d_iface_ptrs[i] = view_2d(mem, ncol, nlev+1);
-    mem += view_2d_iface_ptrs[i]->size();
-  }
-
   // WSM data
   buffer.wsm_data = mem;
 
@@ -681,6 +649,21 @@ void compute_updraft_velocities(const Team& team,
   });
 }
 
+// Computes mixing ratios for a dry atmosphere state from a wet atmosphere
+// state at the given column and level. Since this is a pointwise operation,
+// it can be called from a kernel flattened over (column, level).
+KOKKOS_INLINE_FUNCTION
+void compute_dry_mixing_ratios(const WetAtmosphere& wet_atm,
+                               const DryAtmosphere& dry_atm,
+                               const int i, const int k) {
+  const auto qv_ik = wet_atm.qv(i,k);
+  dry_atm.qv(i,k) = PF::calculate_drymmr_from_wetmmr(wet_atm.qv(i,k), qv_ik);
+  dry_atm.qc(i,k) = PF::calculate_drymmr_from_wetmmr(wet_atm.qc(i,k), qv_ik);
+  dry_atm.nc(i,k) = PF::calculate_drymmr_from_wetmmr(wet_atm.nc(i,k), qv_ik);
+  dry_atm.qi(i,k) = PF::calculate_drymmr_from_wetmmr(wet_atm.qi(i,k), qv_ik);
+  dry_atm.ni(i,k) = PF::calculate_drymmr_from_wetmmr(wet_atm.ni(i,k), qv_ik);
+}
+
 // Given a thread team and a wet atmosphere state, dispatches threads
 // from the team to compute mixing ratios for a dry atmosphere state in th
 // column with the given index.
@@ -695,15 +678,37 @@ void compute_dry_mixing_ratios(const Team& team,
   constexpr int nlev = mam4::nlev;
   int i = column_index;
   Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlev), [&] (const int k) {
-    const auto qv_ik = wet_atm.qv(i,k);
-    dry_atm.qv(i,k) = PF::calculate_drymmr_from_wetmmr(wet_atm.qv(i,k), qv_ik);
-    dry_atm.qc(i,k) = PF::calculate_drymmr_from_wetmmr(wet_atm.qc(i,k), qv_ik);
-    dry_atm.nc(i,k) = PF::calculate_drymmr_from_wetmmr(wet_atm.nc(i,k), qv_ik);
-    dry_atm.qi(i,k) = PF::calculate_drymmr_from_wetmmr(wet_atm.qi(i,k), qv_ik);
-    dry_atm.ni(i,k) = PF::calculate_drymmr_from_wetmmr(wet_atm.ni(i,k), qv_ik);
+    compute_dry_mixing_ratios(wet_atm, dry_atm, i, k);
   });
 }
 
+// Computes mixing ratios for the given dry aerosol state from the wet
+// atmospheric and aerosol states at the given column and level.
+KOKKOS_INLINE_FUNCTION
+void compute_dry_mixing_ratios(const WetAtmosphere& wet_atm,
+                               const AerosolState& wet_aero,
+                               const AerosolState& dry_aero,
+                               const int i, const int k) {
+  const auto qv_ik = wet_atm.qv(i,k);
+  for (int m = 0; m < num_aero_modes(); ++m) {
+    dry_aero.int_aero_nmr[m](i,k) = PF::calculate_drymmr_from_wetmmr(wet_aero.int_aero_nmr[m](i,k), qv_ik);
+    if (dry_aero.cld_aero_nmr[m].data()) {
+      dry_aero.cld_aero_nmr[m](i,k) = PF::calculate_drymmr_from_wetmmr(wet_aero.cld_aero_nmr[m](i,k), qv_ik);
+    }
+    for (int a = 0; a < num_aero_species(); ++a) {
+      if (dry_aero.int_aero_mmr[m][a].data()) {
+        dry_aero.int_aero_mmr[m][a](i,k) = PF::calculate_drymmr_from_wetmmr(wet_aero.int_aero_mmr[m][a](i,k), qv_ik);
+      }
+      if (dry_aero.cld_aero_mmr[m][a].data()) {
+        dry_aero.cld_aero_mmr[m][a](i,k) = PF::calculate_drymmr_from_wetmmr(wet_aero.cld_aero_mmr[m][a](i,k), qv_ik);
+      }
+    }
+  }
+  for (int g = 0; g < num_aero_gases(); ++g) {
+    dry_aero.gas_mmr[g](i,k) = PF::calculate_drymmr_from_wetmmr(wet_aero.gas_mmr[g](i,k), qv_ik);
+  }
+}
+
 // Given a thread team and wet atmospheric and aerosol states, dispatches threads
 // from the team to compute mixing ratios for the given dry interstitial aerosol
 // state for the column with the given index.
@@ -719,25 +724,35 @@ void compute_dry_mixing_ratios(const Team& team,
   constexpr int nlev = mam4::nlev;
   int i = column_index;
   Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlev), [&] (const int k) {
-    const auto qv_ik = wet_atm.qv(i,k);
-    for (int m = 0; m < num_aero_modes(); ++m) {
-      dry_aero.int_aero_nmr[m](i,k) = PF::calculate_drymmr_from_wetmmr(wet_aero.int_aero_nmr[m](i,k), qv_ik);
-      if (dry_aero.cld_aero_nmr[m].data()) {
-        dry_aero.cld_aero_nmr[m](i,k) = PF::calculate_drymmr_from_wetmmr(wet_aero.cld_aero_nmr[m](i,k), qv_ik);
+    compute_dry_mixing_ratios(wet_atm, wet_aero, dry_aero, i, k);
+  });
+}
+
+// Computes mixing ratios for the given wet aerosol state from the dry
+// atmospheric and aerosol states at the given column and level.
+KOKKOS_INLINE_FUNCTION
+void compute_wet_mixing_ratios(const DryAtmosphere& dry_atm,
+                               const AerosolState& dry_aero,
+                               const AerosolState& wet_aero,
+                               const int i, const int k) {
+  const auto qv_ik = dry_atm.qv(i,k);
+  for (int m = 0; m < num_aero_modes(); ++m) {
+    wet_aero.int_aero_nmr[m](i,k) = PF::calculate_wetmmr_from_drymmr(dry_aero.int_aero_nmr[m](i,k), qv_ik);
+    if (wet_aero.cld_aero_nmr[m].data()) {
+      wet_aero.cld_aero_nmr[m](i,k) = PF::calculate_wetmmr_from_drymmr(dry_aero.cld_aero_nmr[m](i,k), qv_ik);
+    }
+    for (int a = 0; a < num_aero_species(); ++a) {
+      if (wet_aero.int_aero_mmr[m][a].data()) {
+        wet_aero.int_aero_mmr[m][a](i,k) = PF::calculate_wetmmr_from_drymmr(dry_aero.int_aero_mmr[m][a](i,k), qv_ik);
       }
-      for (int a = 0; a < num_aero_species(); ++a) {
-        if (dry_aero.int_aero_mmr[m][a].data()) {
-          dry_aero.int_aero_mmr[m][a](i,k) = PF::calculate_drymmr_from_wetmmr(wet_aero.int_aero_mmr[m][a](i,k), qv_ik);
-        }
-        if (dry_aero.cld_aero_mmr[m][a].data()) {
-          dry_aero.cld_aero_mmr[m][a](i,k) = PF::calculate_drymmr_from_wetmmr(wet_aero.cld_aero_mmr[m][a](i,k), qv_ik);
-        }
+      if (wet_aero.cld_aero_mmr[m][a].data()) {
+        wet_aero.cld_aero_mmr[m][a](i,k) = PF::calculate_wetmmr_from_drymmr(dry_aero.cld_aero_mmr[m][a](i,k), qv_ik);
       }
     }
-    for (int g = 0; g < num_aero_gases(); ++g) {
-      dry_aero.gas_mmr[g](i,k) = PF::calculate_drymmr_from_wetmmr(wet_aero.gas_mmr[g](i,k), qv_ik);
-    }
-  });
+  }
+  for (int g = 0; g < num_aero_gases(); ++g) {
+    wet_aero.gas_mmr[g](i,k) = PF::calculate_wetmmr_from_drymmr(dry_aero.gas_mmr[g](i,k), qv_ik);
+  }
 }
 
 // Given a thread team and dry atmospheric and aerosol states, dispatches threads
@@ -755,27 +770,150 @@ void compute_wet_mixing_ratios(const Team& team,
   constexpr int nlev = mam4::nlev;
   int i = column_index;
   Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlev), [&] (const int k) {
-    const auto qv_ik = dry_atm.qv(i,k);
-    for (int m = 0; m < num_aero_modes(); ++m) {
-      wet_aero.int_aero_nmr[m](i,k) = PF::calculate_wetmmr_from_drymmr(dry_aero.int_aero_nmr[m](i,k), qv_ik);
-      if (wet_aero.cld_aero_nmr[m].data()) {
-        wet_aero.cld_aero_nmr[m](i,k) = PF::calculate_wetmmr_from_drymmr(dry_aero.cld_aero_nmr[m](i,k), qv_ik);
-      }
-      for (int a = 0; a < num_aero_species(); ++a) {
-        if (wet_aero.int_aero_mmr[m][a].data()) {
-          wet_aero.int_aero_mmr[m][a](i,k) = PF::calculate_wetmmr_from_drymmr(dry_aero.int_aero_mmr[m][a](i,k), qv_ik);
-        }
-        if (wet_aero.cld_aero_mmr[m][a].data()) {
-          wet_aero.cld_aero_mmr[m][a](i,k) = PF::calculate_wetmmr_from_drymmr(dry_aero.cld_aero_mmr[m][a](i,k), qv_ik);
-        }
-      }
-    }
-    for (int g = 0; g < num_aero_gases(); ++g) {
-      wet_aero.gas_mmr[g](i,k) = PF::calculate_wetmmr_from_drymmr(dry_aero.gas_mmr[g](i,k), qv_ik);
-    }
+    compute_wet_mixing_ratios(dry_atm, dry_aero, wet_aero, i, k);
   });
 }
 
+// Storage for the dry atmosphere quantities that all MAM processes derive
+// from the wet state in the same way (dry mixing ratios of water species,
+// layer heights, and updraft velocity). One instance is shared by all the
+// MAM processes on the same grid that read the same input fields, so that
+// these quantities (including the vertical integration for the layer heights)
+// are computed only when one of the input fields has been modified since the
+// last computation.
+// NOTE: the cached views are read-only for the MAM processes. A process that
+//       needs to modify them must copy them in its own buffer.
+class DryAtmCache {
+public:
+  // Returns the cache for the given grid and input fields, creating it if
+  // needed. Caches are identified by the grid name *and* the inputs data, so
+  // that processes using different field managers on grids with the same name
+  // do not share the cache. The cache lives as long as at least one process
+  // holds a pointer to it.
+  static std::shared_ptr<DryAtmCache> get (const std::string& grid_name,
+                                           const int ncol, const int nlev,
+                                           const std::vector<Field>& inputs) {
+    using key_t = std::pair<std::string,std::vector<const char*>>;
+    static std::map<key_t,std::weak_ptr<DryAtmCache>> caches;
+    const key_t key (grid_name,inputs_data(inputs));
+    auto c = caches[key].lock();
+    if (not c) {
+      c = std::make_shared<DryAtmCache>(ncol,nlev);
+      caches[key] = c;
+    }
+    EKAT_REQUIRE_MSG (c->ncol()==ncol and c->nlev()==nlev,
+        "Error! MAM dry atm cache for grid '" + grid_name + "' has different sizes.\n"
+        "  - cache ncol/nlev: " + std::to_string(c->ncol()) + "/" + std::to_string(c->nlev()) + "\n"
+        "  - input ncol/nlev: " + std::to_string(ncol) + "/" + std::to_string(nlev) + "\n");
+    return c;
+  }
+
+  DryAtmCache (const int ncol, const int nlev)
+   : m_ncol(ncol), m_nlev(nlev)
+  {
+    qv        = view_2d("mam_dry_atm_qv",ncol,nlev);
+    qc        = view_2d("mam_dry_atm_qc",ncol,nlev);
+    nc        = view_2d("mam_dry_atm_nc",ncol,nlev);
+    qi        = view_2d("mam_dry_atm_qi",ncol,nlev);
+    ni        = view_2d("mam_dry_atm_ni",ncol,nlev);
+    z_mid     = view_2d("mam_dry_atm_z_mid",ncol,nlev);
+    dz        = view_2d("mam_dry_atm_dz",ncol,nlev);
+    w_updraft = view_2d("mam_dry_atm_w_updraft",ncol,nlev);
+    z_iface   = view_2d("mam_dry_atm_z_iface",ncol,nlev+1);
+  }
+
+  int ncol () const { return m_ncol; }
+  int nlev () const { return m_nlev; }
+
+  // Names of the fields that the cached quantities are computed from
+  static std::vector<std::string> input_field_names () {
+    return {"T_mid", "p_mid", "pseudo_density", "omega", "qv", "qc", "nc", "qi", "ni"};
+  }
+
+  // Make the dry atm use the cached views
+  void set_views (DryAtmosphere& dry_atm) const {
+    dry_atm.qv        = qv;
+    dry_atm.qc        = qc;
+    dry_atm.nc        = nc;
+    dry_atm.qi        = qi;
+    dry_atm.ni        = ni;
+    dry_atm.z_mid     = z_mid;
+    dry_atm.dz        = dz;
+    dry_atm.w_updraft = w_updraft;
+    dry_atm.z_iface   = z_iface;
+  }
+
+  // Recompute the cached quantities, unless none of the input fields changed
+  // since the last call. The input fields must include all the fields that
+  // wet_atm and dry_atm views are taken from. Returns true if quantities
+  // were recomputed.
+  bool update (const WetAtmosphere& wet_atm,
+               const DryAtmosphere& dry_atm,
+               const std::vector<Field>& inputs)
+  {
+    EKAT_REQUIRE_MSG (dry_atm.dz.data()==dz.data(),
+        "Error! The input dry atm does not use the cached views.\n");
+    EKAT_REQUIRE_MSG (inputs.size()==input_field_names().size(),
+        "Error! Wrong number of input fields for the MAM dry atm cache.\n");
+
+    // The update counters only tell us if the *same* fields were modified,
+    // so we also check that the inputs are the fields used last time
+    std::map<std::string,std::int64_t> num_updates;
+    for (const auto& f : inputs) {
+      num_updates[f.name()] = f.get_header().get_tracking().get_num_updates();
+    }
+    const auto data = inputs_data(inputs);
+    if (num_updates==m_num_updates and data==m_inputs_data) {
+      return false;
+    }
+
+    const auto policy = ekat::ExeSpaceUtils<KT::ExeSpace>::
+      get_thread_range_parallel_scan_team_policy(m_ncol, m_nlev);
+    Kokkos::parallel_for("mam_dry_atm_cache_update", policy,
+      KOKKOS_LAMBDA(const Team& team) {
+      const int i = team.league_rank();
+      compute_dry_mixing_ratios(team, wet_atm, dry_atm, i);
+      team.team_barrier();
+      // vertical heights has to be computed after computing dry mixing ratios
+      // for atmosphere
+      compute_vertical_layer_heights(team, dry_atm, i);
+      compute_updraft_velocities(team, wet_atm, dry_atm, i);
+    });
+    Kokkos::fence();
+
+    m_num_updates = num_updates;
+    m_inputs_data = data;
+    return true;
+  }
+
+  // Force recomputation at the next call to update
+  void invalidate () {
+    m_num_updates.clear();
+    m_inputs_data.clear();
+  }
+
+protected:
+  // Pointers to the input fields data, which identify the fields
+  static std::vector<const char*> inputs_data (const std::vector<Field>& inputs) {
+    std::vector<const char*> data;
+    for (const auto& f : inputs) {
+      data.push_back(f.get_internal_view_data<const char>());
+    }
+    return data;
+  }
+
+  int m_ncol;
+  int m_nlev;
+
+  // Number of updates and data of the input fields at the last update call
+  std::map<std::string,std::int64_t> m_num_updates;
+  std::vector<const char*>           m_inputs_data;
+
+  view_2d qv, qc, nc, qi, ni;
+  view_2d z_mid, dz, w_updraft;
+  view_2d z_iface;
+};
+
 // Computes the reciprocal of pseudo density for a column
 inline
 void compute_recipical_pseudo_density(haero::ThreadTeamPolicy team_policy,
@@ -216,18 +216,21 @@ inline void create_linoz_chlorine_reader(
       compute_number_days_from_zero(time_stamp_beg) - compute_number_days_from_zero(model_time);
   scorpio::register_file(linoz_chlorine_file, scorpio::Read);
   const int nlevs_time = scorpio::get_time_len(linoz_chlorine_file);
+  // Read all records at once, rather than one (collective) read per time index
+  std::vector<int> dates(nlevs_time);
+  std::vector<Real> chlorine_loading(nlevs_time);
+  scorpio::read_all_records(linoz_chlorine_file, "date", dates.data());
+  scorpio::read_all_records(linoz_chlorine_file, "chlorine_loading",
+                            chlorine_loading.data());
+  scorpio::release_file(linoz_chlorine_file);
   for(int itime = 0; itime < nlevs_time; ++itime) {
-    int date;
-    scorpio::read_var(linoz_chlorine_file, "date", &date, itime);
+    const int date = dates[itime];
     if(date >= chlorine_loading_ymd) {
-      Real value;
-      scorpio::read_var(linoz_chlorine_file, "chlorine_loading", &value, itime);
-      values.push_back(value);
+      values.push_back(chlorine_loading[itime]);
       auto time_stamp = convert_date(date);
       time_secs.push_back(compute_number_days_from_zero(time_stamp) - offset_time);
     }
   }  // end itime
-  scorpio::release_file(linoz_chlorine_file);
 }
 
 // Gets the times from the NC file
@@ -243,14 +246,13 @@ inline void get_time_from_ncfile(const std::string &file_name,
   scorpio::register_file(file_name, scorpio::Read);
   const int nlevs_time = scorpio::get_time_len(file_name);
   cyclical_ymd_index   = -1;
+  const int ndates     = dates.size();
+  dates.resize(ndates + nlevs_time);
+  scorpio::read_all_records(file_name, "date", dates.data() + ndates);
   for(int itime = 0; itime < nlevs_time; ++itime) {
-    int date;
-    scorpio::read_var(file_name, "date", &date, itime);
-    // std::cout << itime << " date: " << date << "\n";
-    if(date >= cyclical_ymd && cyclical_ymd_index == -1) {
+    if(dates[ndates + itime] >= cyclical_ymd && cyclical_ymd_index == -1) {
       cyclical_ymd_index = itime;
     }
-    dates.push_back(date);
   }  // end itime
 
   EKAT_REQUIRE_MSG(cyclical_ymd_index >= 0,
@@ -346,10 +348,10 @@ inline void setup_tracer_data(TracerData &tracer_data,             // out
   {
     const int nlevs_time   = scorpio::get_dimlen(trace_data_file, "time");
     int cyclical_ymd_index = -1;
+    std::vector<int> dates(nlevs_time);
+    scorpio::read_all_records(trace_data_file, "date", dates.data());
     for(int itime = 0; itime < nlevs_time; ++itime) {
-      int date;
-      scorpio::read_var(trace_data_file, "date", &date, itime);
-      if(date >= cyclical_ymd) {
+      if(dates[itime] >= cyclical_ymd) {
         cyclical_ymd_index = itime;
         break;
       }
@@ -0,0 +1,137 @@
+#include "catch2/catch.hpp"
+
+#include "physics/mam/mam_coupling.hpp"
+#include "share/field/field.hpp"
+
+#include <map>
+
+namespace {
+
+TEST_CASE("mam_dry_atm_cache", "") {
+  using namespace scream;
+  using namespace ekat::units;
+  using namespace ShortFieldTagsNames;
+  using mam_coupling::PF;
+
+  constexpr int ncol = 3;
+  constexpr int nlev = mam4::nlev;
+  const std::string grid_name = "test_grid";
+
+  // Create the input fields, with some physically sensible values
+  std::map<std::string,Real> values = {
+    {"T_mid",          280.0},
+    {"p_mid",          8e4},
+    {"pseudo_density", 1e3},
+    {"omega",          -0.1},
+    {"qv",             1e-2},
+    {"qc",             1e-4},
+    {"nc",             1e6},
+    {"qi",             1e-5},
+    {"ni",             1e5}
+  };
+  FieldLayout layout ({COL,LEV},{ncol,nlev});
+
+  // Creates a set of input fields, and the wet/dry atm viewing them
+  struct FieldSet {
+    std::map<std::string,Field> fields;
+    std::vector<Field> inputs;
+    mam_coupling::WetAtmosphere wet_atm;
+    mam_coupling::DryAtmosphere dry_atm;
+  };
+  auto create_field_set = [&](const Real qc) {
+    FieldSet fs;
+    for (const auto& name : mam_coupling::DryAtmCache::input_field_names()) {
+      Field f (FieldIdentifier(name,layout,Units::nondimensional(),grid_name));
+      f.allocate_view();
+      f.deep_copy(name=="qc" ? qc : values.at(name));
+      fs.fields[name] = f;
+      fs.inputs.push_back(f);
+    }
+
+    fs.wet_atm.qv = fs.fields["qv"].get_view<const Real**>();
+    fs.wet_atm.qc = fs.fields["qc"].get_view<const Real**>();
+    fs.wet_atm.nc = fs.fields["nc"].get_view<const Real**>();
+    fs.wet_atm.qi = fs.fields["qi"].get_view<const Real**>();
+    fs.wet_atm.ni = fs.fields["ni"].get_view<const Real**>();
+
+    fs.dry_atm.z_surf = 0;
+    fs.dry_atm.T_mid  = fs.fields["T_mid"].get_view<const Real**>();
+    fs.dry_atm.p_mid  = fs.fields["p_mid"].get_view<const Real**>();
+    fs.dry_atm.p_del  = fs.fields["pseudo_density"].get_view<const Real**>();
+    fs.dry_atm.omega  = fs.fields["omega"].get_view<const Real**>();
+    return fs;
+  };
+
+  auto fs = create_field_set(values["qc"]);
+  auto& fields  = fs.fields;
+  auto& inputs  = fs.inputs;
+  auto& wet_atm = fs.wet_atm;
+  auto& dry_atm = fs.dry_atm;
+
+  // The cache is shared by all users of the same fields on the same grid
+  auto cache = mam_coupling::DryAtmCache::get(grid_name,ncol,nlev,inputs);
+  REQUIRE (mam_coupling::DryAtmCache::get(grid_name,ncol,nlev,inputs)==cache);
+  REQUIRE_THROWS (mam_coupling::DryAtmCache::get(grid_name,ncol+1,nlev,inputs));
+  cache->set_views(dry_atm);
+
+  auto check_dry_qc = [&](const mam_coupling::DryAtmosphere& dry,
+                          const Real qc_wet) {
+    const Real expected = PF::calculate_drymmr_from_wetmmr(qc_wet,values["qv"]);
+    auto qc_dry = Kokkos::create_mirror_view(dry.qc);
+    Kokkos::deep_copy(qc_dry,dry.qc);
+    for (int i=0; i<ncol; ++i) {
+      for (int k=0; k<nlev; ++k) {
+        REQUIRE (qc_dry(i,k)==expected);
+      }
+    }
+  };
+  auto check_qc_dry = [&](const Real qc_wet) {
+    check_dry_qc(dry_atm,qc_wet);
+  };
+
+  // First call computes, second call does nothing, since inputs did not change
+  REQUIRE (cache->update(wet_atm,dry_atm,inputs));
+  check_qc_dry(values["qc"]);
+  REQUIRE (not cache->update(wet_atm,dry_atm,inputs));
+
+  // Changing an input without marking it as updated is not detected...
+  fields["qc"].deep_copy(2*values["qc"]);
+  REQUIRE (not cache->update(wet_atm,dry_atm,inputs));
+  check_qc_dry(values["qc"]);
+
+  // ...but marking it (as AtmosphereProcess does after each subcycle) is
+  fields["qc"].get_header().get_tracking().mark_updated();
+  REQUIRE (cache->update(wet_atm,dry_atm,inputs));
+  check_qc_dry(2*values["qc"]);
+  REQUIRE (not cache->update(wet_atm,dry_atm,inputs));
+
+  // Invalidating forces a recomputation
+  cache->invalidate();
+  REQUIRE (cache->update(wet_atm,dry_atm,inputs));
+
+  // A dry atm that does not use the cached views is rejected
+  mam_coupling::DryAtmosphere other = dry_atm;
+  other.dz = mam_coupling::view_2d("dz",ncol,nlev);
+  REQUIRE_THROWS (cache->update(wet_atm,other,inputs));
+
+  // Another set of fields on a grid with the same name (e.g., from another
+  // field manager) gets its own cache, even if the update counters match
+  auto fs2 = create_field_set(3*values["qc"]);
+  auto cache2 = mam_coupling::DryAtmCache::get(grid_name,ncol,nlev,fs2.inputs);
+  REQUIRE (cache2!=cache);
+  cache2->set_views(fs2.dry_atm);
+  REQUIRE (cache2->update(fs2.wet_atm,fs2.dry_atm,fs2.inputs));
+  check_dry_qc(fs2.dry_atm,3*values["qc"]);
+  check_qc_dry(2*values["qc"]);
+
+  // A cache fed with different fields recomputes, rather than serving stale data
+  REQUIRE (not cache->update(wet_atm,dry_atm,inputs));
+  mam_coupling::DryAtmosphere dry_atm2 = fs2.dry_atm;
+  cache->set_views(dry_atm2);
+  REQUIRE (cache->update(fs2.wet_atm,dry_atm2,fs2.inputs));
+  check_qc_dry(3*values["qc"]);
+  REQUIRE (cache->update(wet_atm,dry_atm,inputs));
+  check_qc_dry(2*values["qc"]);
+}
+
+} // anonymous namespace
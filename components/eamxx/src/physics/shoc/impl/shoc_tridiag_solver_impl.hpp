@@ -74,6 +74,84 @@ void Functions<S,D>::vd_shoc_decomp(
   });
 }
 
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>::vd_shoc_decomp(
+  const MemberType&            team,
+  const Int&                   nlev,
+  const uview_1d<const Spack>& kv_term_m,
+  const uview_1d<const Spack>& kv_term_h,
+  const uview_1d<const Spack>& tmpi,
+  const uview_1d<const Spack>& rdp_zt,
+  const Scalar&                dtime,
+  const Scalar&                flux_m,
+  const Scalar&                flux_h,
+  const uview_1d<Scalar>&      du_m,
+  const uview_1d<Scalar>&      dl_m,
+  const uview_1d<Scalar>&      d_m,
+  const uview_1d<Scalar>&      du_h,
+  const uview_1d<Scalar>&      dl_h,
+  const uview_1d<Scalar>&      d_h)
+{
+  const auto ggr = C::gravit;
+
+  const auto skv_term_m = scalarize(kv_term_m);
+  const auto skv_term_h = scalarize(kv_term_h);
+  const auto stmpi = scalarize(tmpi);
+
+  const Int nlev_pack = ekat::npack<Spack>(nlev);
+
+  // Compute entries of both tridiagonal systems. The arithmetic for each
+  // system is the same as in the single-system version above, so results are BFB.
+  Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlev_pack), [&] (const Int& k) {
+
+    // Compute shift of kv_term's and tmpi
+    Spack kvm_k, kvm_kp1, kvh_k, kvh_kp1, tmpi_k, tmpi_kp1;
+    const auto range_pack = ekat::range<IntSmallPack>(k*Spack::n);
+
+    IntSmallPack shift_range;
+    vector_simd
+    for (int s = 0; s < Spack::n; ++s) {
+      shift_range[s] = range_pack[s];
+    }
+
+    shift_range.set(range_pack > nlev-1, 1); // don't calculate shift above nlev-1
+    ekat::index_and_shift<1>(skv_term_m, shift_range, kvm_k, kvm_kp1);
+    ekat::index_and_shift<1>(skv_term_h, shift_range, kvh_k, kvh_kp1);
+    ekat::index_and_shift<1>(stmpi, shift_range, tmpi_k, tmpi_kp1);
+
+    const auto rdp_k = rdp_zt(k);
+    const auto top = range_pack == 0;
+    const auto bot = range_pack == nlev-1;
+
+    // Super/sub diagonals, with the boundary entries zeroed out
+    Spack du_mk = -kvm_kp1*tmpi_kp1*rdp_k;
+    Spack dl_mk = -kv_term_m(k)*tmpi(k)*rdp_k;
+    Spack du_hk = -kvh_kp1*tmpi_kp1*rdp_k;
+    Spack dl_hk = -kv_term_h(k)*tmpi(k)*rdp_k;
+    du_mk.set(bot, 0);
+    dl_mk.set(top, 0);
+    du_hk.set(bot, 0);
+    dl_hk.set(top, 0);
+
+    // Diagonals, with the implicit surface fluxes at the bottom level
+    Spack d_mk = 1 - du_mk - dl_mk;
+    Spack d_hk = 1 - du_hk - dl_hk;
+    d_mk.set(bot, d_mk + flux_m*dtime*ggr*rdp_k);
+    d_hk.set(bot, d_hk + flux_h*dtime*ggr*rdp_k);
+
+    // Diagonals must be scalar in nlev.
+    for (Int p=0; p<Spack::n && range_pack[p]<nlev; ++p) {
+      du_m(range_pack[p]) = du_mk[p];
+      dl_m(range_pack[p]) = dl_mk[p];
+      d_m (range_pack[p]) = d_mk [p];
+      du_h(range_pack[p]) = du_hk[p];
+      dl_h(range_pack[p]) = dl_hk[p];
+      d_h (range_pack[p]) = d_hk [p];
+    }
+  });
+}
+
 template<typename S, typename D>
 KOKKOS_FUNCTION
 void Functions<S,D>::vd_shoc_solve(
@@ -45,18 +45,23 @@ void Functions<S,D>::update_prognostics_implicit(
   uview_1d<Spack> tmpi, tkh_zi,
                   tk_zi, rho_zi,
                   rdp_zt;
-  uview_1d<Scalar> du_workspace, dl_workspace, d_workspace;
+  uview_1d<Scalar> du_workspace, dl_workspace, d_workspace,
+                   duh_workspace, dlh_workspace, dh_workspace;
 
   workspace.template take_many_contiguous_unsafe<5>(
     {"tmpi", "tkh_zi", "tk_zi", "rho_zi", "rdp_zt"},
     {&tmpi, &tkh_zi, &tk_zi, &rho_zi, &rdp_zt});
 
-  workspace.template take_many_contiguous_unsafe<3, Scalar>(
-    {"du_workspace", "dl_workspace", "d_workspace"},
-    {&du_workspace, &dl_workspace, &d_workspace});
-  auto du = Kokkos::subview(du_workspace, Kokkos::make_pair(0,nlev));
-  auto dl = Kokkos::subview(dl_workspace, Kokkos::make_pair(0,nlev));
-  auto d  = Kokkos::subview(d_workspace,  Kokkos::make_pair(0,nlev));
+  // Diagonals of the momentum (du,dl,d) and thermo (du_h,dl_h,d_h) systems
+  workspace.template take_many_contiguous_unsafe<6, Scalar>(
+    {"du_workspace", "dl_workspace", "d_workspace", "duh_workspace", "dlh_workspace", "dh_workspace"},
+    {&du_workspace, &dl_workspace, &d_workspace, &duh_workspace, &dlh_workspace, &dh_workspace});
+  auto du   = Kokkos::subview(du_workspace,  Kokkos::make_pair(0,nlev));
+  auto dl   = Kokkos::subview(dl_workspace,  Kokkos::make_pair(0,nlev));
+  auto d    = Kokkos::subview(d_workspace,   Kokkos::make_pair(0,nlev));
+  auto du_h = Kokkos::subview(duh_workspace, Kokkos::make_pair(0,nlev));
+  auto dl_h = Kokkos::subview(dlh_workspace, Kokkos::make_pair(0,nlev));
+  auto d_h  = Kokkos::subview(dh_workspace,  Kokkos::make_pair(0,nlev));
 
   // 2d allocations for solver RHS
   const int num_wind_transpose_packs = ekat::npack<Spack>(2);
@@ -160,27 +165,23 @@ void Functions<S,D>::update_prognostics_implicit(
     qtracers_rhs_s(k, num_qtracers+2) = tke_s(k);
   });
 
-  // march u_wind and v_wind one step forward using implicit solver
-  {
-    // Call decomp for momentum variables
-    vd_shoc_decomp(team, nlev, tk_zi, tmpi, rdp_zt, dtime, ksrf, du, dl, d);
+  // Build the momentum and thermo systems in one pass. For thermo variables,
+  // fluxes are applied explicitly, so zero fluxes out for implicit solver
+  // decomposition.
+  vd_shoc_decomp(team, nlev, tk_zi, tkh_zi, tmpi, rdp_zt, dtime, ksrf, 0,
+                 du, dl, d, du_h, dl_h, d_h);
+  team.team_barrier();
 
-    // Solve
-    team.team_barrier();
-    vd_shoc_solve(team, du, dl, d, wind_rhs);
-  }
+  // March u_wind and v_wind one step forward using implicit solver. The two
+  // rhs are packed in wind_rhs, so they are swept together.
+  vd_shoc_solve(team, du, dl, d, wind_rhs);
 
-  // march temperature, total water, tke,and tracers one step forward using implicit solver
-  {
-    // Call decomp for thermo variables. Fluxes applied explicitly, so zero
-    // fluxes out for implicit solver decomposition.
-    team.team_barrier();
-    vd_shoc_decomp(team, nlev, tkh_zi, tmpi, rdp_zt, dtime, 0, du, dl, d);
-
-    // Solve
-    team.team_barrier();
-    vd_shoc_solve(team, du, dl, d, qtracers_rhs);
-  }
+  // March temperature, total water, tke, and tracers one step forward using
+  // implicit solver. The systems do not share any data, so no barrier is
+  // needed between the two solves. All rhs are packed in qtracers_rhs (one
+  // Spack per group of Spack::n variables), so the matrix is factored once
+  // and each sweep is SIMD across variables.
+  vd_shoc_solve(team, du_h, dl_h, d_h, qtracers_rhs);
 
   // Copy RHS values back into output variables
   team.team_barrier();
@@ -202,8 +203,8 @@ void Functions<S,D>::update_prognostics_implicit(
   team.team_barrier();
   workspace.template release_macro_block<Scalar>(tracers_slot,n_trac_slots);
   workspace.template release_macro_block<Scalar>(wind_slot,n_wind_slots);
-  workspace.template release_many_contiguous<3,Scalar>(
-    {&du_workspace, &dl_workspace, &d_workspace});
+  workspace.template release_many_contiguous<6,Scalar>(
+    {&du_workspace, &dl_workspace, &d_workspace, &duh_workspace, &dlh_workspace, &dh_workspace});
   workspace.template release_many_contiguous<5>(
     {&tmpi, &tkh_zi, &tk_zi, &rho_zi, &rdp_zt});
 }
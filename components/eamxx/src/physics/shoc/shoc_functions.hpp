@@ -1199,6 +1199,26 @@ struct Functions
     const uview_1d<Scalar>&      dl,
     const uview_1d<Scalar>&      d);
 
+  // Same as above, but builds the momentum and thermo systems in a single pass,
+  // sharing the shifts of tmpi and the loads of rdp_zt.
+  KOKKOS_FUNCTION
+  static void vd_shoc_decomp(
+    const MemberType&            team,
+    const Int&                   nlev,
+    const uview_1d<const Spack>& kv_term_m,
+    const uview_1d<const Spack>& kv_term_h,
+    const uview_1d<const Spack>& tmpi,
+    const uview_1d<const Spack>& rdp_zt,
+    const Scalar&                dtime,
+    const Scalar&                flux_m,
+    const Scalar&                flux_h,
+    const uview_1d<Scalar>&      du_m,
+    const uview_1d<Scalar>&      dl_m,
+    const uview_1d<Scalar>&      d_m,
+    const uview_1d<Scalar>&      du_h,
+    const uview_1d<Scalar>&      dl_h,
+    const uview_1d<Scalar>&      d_h);
+
   KOKKOS_FUNCTION
   static void vd_shoc_solve(
     const MemberType&       team,
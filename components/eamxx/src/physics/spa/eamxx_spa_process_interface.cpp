@@ -220,6 +220,9 @@ void SPA::initialize_impl (const RunType /* run_type */)
   SPAData_out.AER_TAU_SW = get_field_out("aero_tau_sw").get_view<Spack***>();
   SPAData_out.AER_TAU_LW = get_field_out("aero_tau_lw").get_view<Spack***>();
 
+  // Source data is padded with one level at the top and bottom
+  SPAVertInterp = std::make_shared<SPAFunc::LIV>(m_num_cols,m_num_src_levs+2,m_num_levs);
+
   // Load the first month into spa_end.
   // Note: At the first time step, the data will be moved into spa_beg,
   //       and spa_end will be reloaded from file with the new month.
@@ -251,7 +254,8 @@ void SPA::run_impl (const double dt)
   // Call the main SPA routine to get interpolated aerosol forcings.
   const auto& pmid_tgt = get_field_in("p_mid").get_view<const Spack**>();
   SPAFunc::spa_main(SPATimeState, pmid_tgt, m_buffer.p_mid_src,
-                    SPAData_start,SPAData_end,m_buffer.spa_temp,SPAData_out);
+                    SPAData_start,SPAData_end,m_buffer.spa_temp,SPAData_out,
+                    *SPAVertInterp);
 }
 
 // =========================================================================================
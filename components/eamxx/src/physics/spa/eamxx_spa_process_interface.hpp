@@ -90,6 +90,9 @@ protected:
   SPAFunc::SPAInput         SPAData_end;
   SPAFunc::SPAOutput        SPAData_out;
 
+  // Vertical interpolation object, kept around to avoid re-allocating it every step
+  std::shared_ptr<SPAFunc::LIV> SPAVertInterp;
+
   std::shared_ptr<const AbstractGrid>   m_grid;
 }; // class SPA
 
@@ -9,6 +9,7 @@
 #include "share/scream_types.hpp"
 
 #include <ekat/ekat_pack_utils.hpp>
+#include <ekat/util/ekat_lin_interp.hpp>
 
 namespace scream {
 namespace spa {
@@ -30,6 +31,8 @@ struct SPAFunctions
 
   using gid_type = AbstractGrid::gid_type;
 
+  using LIV = ekat::LinInterp<Real,Spack::n>;
+
   using iop_ptr_type = std::shared_ptr<control::IntensiveObservationPeriod>;
 
   template <typename S>
@@ -188,6 +191,19 @@ struct SPAFunctions
     const SPAInput&   data_tmp,         // Temporary
     const SPAOutput&  data_out);
 
+  // Same as above, but uses the input LinInterp object (which can be stored
+  // by the caller, to avoid re-allocating it at every step), and performs
+  // the time and vertical interpolations in fused kernels (see below).
+  static void spa_main(
+    const SPATimeState& time_state,
+    const view_2d<const Spack>& p_tgt,
+    const view_2d<      Spack>& p_src,  // Temporary
+    const SPAInput&   data_beg,
+    const SPAInput&   data_end,
+    const SPAInput&   data_tmp,         // Temporary
+    const SPAOutput&  data_out,
+    const LIV&        vert_interp);
+
   static void update_spa_data_from_file(
     std::shared_ptr<AtmosphereInput>& scorpio_reader,
     std::shared_ptr<IOPReader>&       iop_reader,
@@ -224,6 +240,24 @@ struct SPAFunctions
       const SPAData&  data_in,
       const SPAData&  data_out);
 
+  // Fused version of the three routines above. One kernel computes the
+  // time-interpolated PS, the source pressure, and the setup of the vertical
+  // interpolation, once per column for all SPA fields. A second kernel blends
+  // beg/end data in time and interpolates it vertically, writing directly
+  // into data_out. Results are BFB with the three routines called in sequence.
+  static void perform_time_and_vertical_interpolation (
+      const SPATimeState& time_state,
+      const view_2d<const Spack>& p_tgt,
+      const view_2d<      Spack>& p_src,
+      const SPAInput&  data_beg,
+      const SPAInput&  data_end,
+      const SPAInput&  data_tmp,
+      const SPAOutput& data_out,
+      const LIV&       vert_interp);
+
+  // The fraction of the month elapsed at time_state.t_now
+  static Real compute_time_fraction (const SPATimeState& time_state);
+
   // Return the subcolumn of the proper variable, where ivar
   // is a condensed idx for var and possibly band. In particular:
   //  - ivar=0: return CCN
@@ -242,6 +242,64 @@ void SPAFunctions<S,D>
   perform_vertical_interpolation(p_src, p_tgt, data_tmp.data, data_out);
 }
 
+template <typename S, typename D>
+void SPAFunctions<S,D>
+::spa_main(
+  const SPATimeState& time_state,
+  const view_2d<const Spack>& p_tgt,
+  const view_2d<      Spack>& p_src,
+  const SPAInput&   data_beg,
+  const SPAInput&   data_end,
+  const SPAInput&   data_tmp,
+  const SPAOutput&  data_out,
+  const LIV&        vert_interp)
+{
+  // Beg/End/Tmp month must have all sizes matching
+  EKAT_REQUIRE_MSG (
+      data_end.data.nswbands==data_beg.data.nswbands &&
+      data_end.data.nswbands==data_tmp.data.nswbands &&
+      data_end.data.nlwbands==data_beg.data.nlwbands &&
+      data_end.data.nlwbands==data_tmp.data.nlwbands,
+      "Error! SPAInput data structs must have the same number of SW/LW bands.\n");
+  EKAT_REQUIRE_MSG (
+      data_end.data.ncols==data_beg.data.ncols &&
+      data_end.data.ncols==data_tmp.data.ncols &&
+      data_end.data.nlevs==data_beg.data.nlevs &&
+      data_end.data.nlevs==data_tmp.data.nlevs,
+      "Error! SPAInput data structs must have the same number of columns/levels.\n");
+  EKAT_REQUIRE_MSG (
+      data_end.data.nswbands==data_out.nswbands &&
+      data_end.data.nlwbands==data_out.nlwbands,
+      "Error! SPAInput and SPAOutput data structs must have the same number of SW/LW bands.\n");
+  EKAT_REQUIRE_MSG (
+      data_end.data.ncols==data_out.ncols,
+      "Error! Horizontal interpolation is performed *before* calling spa_main,\n"
+      "       SPAInput and SPAOutput data structs must have the same number columns.\n");
+
+  perform_time_and_vertical_interpolation(time_state,p_tgt,p_src,data_beg,data_end,
+                                          data_tmp,data_out,vert_interp);
+}
+
+/*-----------------------------------------------------------------*/
+template <typename S, typename D>
+Real SPAFunctions<S,D>
+::compute_time_fraction(const SPATimeState& time_state)
+{
+  auto& t_now = time_state.t_now;
+  auto& t_beg = time_state.t_beg_month;
+  auto& delta_t = time_state.days_this_month;
+
+  auto delta_t_fraction = (t_now-t_beg) / delta_t;
+
+  EKAT_REQUIRE_MSG (delta_t_fraction>=0 && delta_t_fraction<=1,
+      "Error! Convex interpolation with coefficient out of [0,1].\n"
+      "  t_now  : " + std::to_string(t_now) + "\n"
+      "  t_beg  : " + std::to_string(t_beg) + "\n"
+      "  delta_t: " + std::to_string(delta_t) + "\n");
+
+  return delta_t_fraction;
+}
+
 /*-----------------------------------------------------------------*/
 template <typename S, typename D>
 void SPAFunctions<S,D>
@@ -257,11 +315,6 @@ void SPAFunctions<S,D>
   using ExeSpace = typename KT::ExeSpace;
   using ESU = ekat::ExeSpaceUtils<ExeSpace>;
 
-  // Gather time stamp info
-  auto& t_now = time_state.t_now;
-  auto& t_beg = time_state.t_beg_month;
-  auto& delta_t = time_state.days_this_month;
-
   // Makes no sense to have different number of bands
   EKAT_REQUIRE(data_end.data.nswbands==data_beg.data.nswbands);
   EKAT_REQUIRE(data_end.data.nlwbands==data_beg.data.nlwbands);
@@ -276,13 +329,7 @@ void SPAFunctions<S,D>
   const int num_vert_packs = ekat::PackInfo<Spack::n>::num_packs(data_beg.data.nlevs);
   const auto policy = ESU::get_default_team_policy(outer_iters, num_vert_packs);
 
-  auto delta_t_fraction = (t_now-t_beg) / delta_t;
-
-  EKAT_REQUIRE_MSG (delta_t_fraction>=0 && delta_t_fraction<=1,
-      "Error! Convex interpolation with coefficient out of [0,1].\n"
-      "  t_now  : " + std::to_string(t_now) + "\n"
-      "  t_beg  : " + std::to_string(t_beg) + "\n"
-      "  delta_t: " + std::to_string(delta_t) + "\n");
+  const auto delta_t_fraction = compute_time_fraction(time_state);
 
   Kokkos::parallel_for("spa_time_interp_loop", policy,
     KOKKOS_LAMBDA(const MemberType& team) {
@@ -350,7 +397,6 @@ perform_vertical_interpolation(
 {
   using ExeSpace = typename KT::ExeSpace;
   using ESU = ekat::ExeSpaceUtils<ExeSpace>;
-  using LIV = ekat::LinInterp<Real,Spack::n>;
 
   // Makes no sense to have different number of bands
   EKAT_REQUIRE(input.nswbands==output.nswbands);
@@ -402,6 +448,91 @@ perform_vertical_interpolation(
   Kokkos::fence();
 }
 
+template<typename S, typename D>
+void SPAFunctions<S,D>::
+perform_time_and_vertical_interpolation(
+  const SPATimeState& time_state,
+  const view_2d<const Spack>& p_tgt,
+  const view_2d<      Spack>& p_src,
+  const SPAInput&  data_beg,
+  const SPAInput&  data_end,
+  const SPAInput&  data_tmp,
+  const SPAOutput& data_out,
+  const LIV&       vert_interp)
+{
+  using ExeSpace = typename KT::ExeSpace;
+  using ESU = ekat::ExeSpaceUtils<ExeSpace>;
+  using C = scream::physics::Constants<Real>;
+
+  constexpr auto P0 = C::P0;
+
+  const int ncols     = data_beg.data.ncols;
+  const int nlevs_src = data_beg.data.nlevs;
+  const int nlevs_tgt = data_out.nlevs;
+
+  const auto delta_t_fraction = compute_time_fraction(time_state);
+
+  const int num_vars = 1+data_beg.data.nswbands*3+data_beg.data.nlwbands;
+  const int num_src_packs = ekat::PackInfo<Spack::n>::num_packs(nlevs_src);
+  const int num_tgt_packs = ekat::PackInfo<Spack::n>::num_packs(nlevs_tgt);
+
+  const auto& ps_beg = data_beg.PS;
+  const auto& ps_end = data_end.PS;
+  const auto& ps_tmp = data_tmp.PS;
+  const auto& hyam = data_beg.hyam;
+  const auto& hybm = data_beg.hybm;
+
+  // Step 1: time interp of PS, source pressure, and setup of vertical interp,
+  //         done once per column for all the SPA fields.
+  const auto policy_setup = ESU::get_default_team_policy(ncols, num_tgt_packs);
+  Kokkos::parallel_for("spa_p_src_and_vert_interp_setup_loop", policy_setup,
+    KOKKOS_LAMBDA(typename LIV::MemberType const& team) {
+
+    const int icol = team.league_rank();
+    const Real ps = linear_interp(ps_beg(icol),ps_end(icol),delta_t_fraction);
+    Kokkos::single(Kokkos::PerTeam(team),[&]{
+      ps_tmp(icol) = ps;
+    });
+
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,num_src_packs),
+                         [&](const int k) {
+      p_src(icol,k) = ps * hybm(k)  + P0 * hyam(k);
+    });
+    team.team_barrier();
+
+    vert_interp.setup(team, ekat::subview(p_src,icol),
+                            ekat::subview(p_tgt,icol));
+  });
+  Kokkos::fence();
+
+  // Step 2: blend beg/end data in time, and interpolate it in the vertical,
+  //         writing directly into the output views.
+  const int outer_iters = ncols*num_vars;
+  const auto policy_interp = ESU::get_default_team_policy(outer_iters, num_tgt_packs);
+  Kokkos::parallel_for("spa_time_and_vert_interp_loop", policy_interp,
+    KOKKOS_LAMBDA(typename LIV::MemberType const& team) {
+
+    const int icol = team.league_rank() / num_vars;
+    const int ivar = team.league_rank() % num_vars;
+
+    auto var_beg = get_var_column (data_beg.data,icol,ivar);
+    auto var_end = get_var_column (data_end.data,icol,ivar);
+    auto var_tmp = get_var_column (data_tmp.data,icol,ivar);
+    auto var_out = get_var_column (data_out,icol,ivar);
+
+    Kokkos::parallel_for (Kokkos::TeamVectorRange(team,num_src_packs),
+                          [&] (const int& k) {
+      var_tmp(k) = linear_interp(var_beg(k),var_end(k),delta_t_fraction);
+    });
+    team.team_barrier();
+
+    const auto x1 = ekat::subview(p_src,icol);
+    const auto x2 = ekat::subview(p_tgt,icol);
+    vert_interp.lin_interp(team, x1, x2, var_tmp, var_out, icol);
+  });
+  Kokkos::fence();
+}
+
 /*-----------------------------------------------------------------*/
 /* Note: In this routine the SPA source data is padded in the vertical
  * to facilitate the proper behavior at the boundaries when doing the
@@ -346,7 +346,51 @@ TEST_CASE("spa_main")
       check_bounds (sv(data_beg_h.aer_tau_lw,i,n),sv(data_out_h.aer_tau_lw,i,n));
     }
   }
-  std::cout << "  -> vert interp, p_tgt!=p_src and extrapolation needed ... OK!\n\n";
+  std::cout << "  -> vert interp, p_tgt!=p_src and extrapolation needed ... OK!\n";
+
+  // ======================================================== //
+  //          Test fused time+vert interpolation              //
+  // ======================================================== //
+
+  // The fused version must be BFB with the step-by-step one
+  std::cout << "  -> fused time+vert interp\n";
+
+  // Hybrid coords that give a monotone p_src, with the padding levels
+  // bracketing the whole range of p_tgt.
+  auto hyam_h = Kokkos::create_mirror_view(ekat::scalarize(spa_beg.hyam));
+  auto hybm_h = Kokkos::create_mirror_view(ekat::scalarize(spa_beg.hybm));
+  Kokkos::deep_copy(hyam_h,0);
+  for (int k=0; k<nlevs+2; ++k) {
+    hybm_h(k) = k==(nlevs+1) ? 10.0 : Real(k)/(nlevs+1);
+  }
+  Kokkos::deep_copy(ekat::scalarize(spa_beg.hyam),hyam_h);
+  Kokkos::deep_copy(ekat::scalarize(spa_beg.hybm),hybm_h);
+
+  spa_time_state.t_now = t_beg.frac_of_year_in_days() + 0.3*spa_time_state.days_this_month;
+
+  SPAFunc::SPAOutput spa_ref(ncols, nlevs, nswbands, nlwbands);
+  SPAFunc::spa_main(spa_time_state,p_tgt,p_src,spa_beg,spa_end,spa_tmp,spa_ref);
+  SPADataHost data_ref_h(spa_ref);
+  data_ref_h.copy_from_dev(spa_ref);
+
+  SPAFunc::LIV vert_interp(ncols,nlevs+2,nlevs);
+  SPAFunc::spa_main(spa_time_state,p_tgt,p_src,spa_beg,spa_end,spa_tmp,spa_out,vert_interp);
+  data_out_h.copy_from_dev(spa_out);
+
+  for (int i=0; i<ncols; ++i) {
+    for (int k=0; k<nlevs; ++k) {
+      REQUIRE (data_out_h.ccn3(i,k) == data_ref_h.ccn3(i,k));
+      for (int n=0; n<nswbands; ++n) {
+        REQUIRE (data_out_h.aer_g_sw(i,n,k) == data_ref_h.aer_g_sw(i,n,k));
+        REQUIRE (data_out_h.aer_ssa_sw(i,n,k) == data_ref_h.aer_ssa_sw(i,n,k));
+        REQUIRE (data_out_h.aer_tau_sw(i,n,k) == data_ref_h.aer_tau_sw(i,n,k));
+      }
+      for (int n=0; n<nlwbands; ++n) {
+        REQUIRE (data_out_h.aer_tau_lw(i,n,k) == data_ref_h.aer_tau_lw(i,n,k));
+      }
+    }
+  }
+  std::cout << "  -> fused time+vert interp ............................... OK!\n\n";
 }
 
 // Compute min/max of input over [start,end) indices
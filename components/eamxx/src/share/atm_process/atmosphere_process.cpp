@@ -116,6 +116,11 @@ void AtmosphereProcess::run (const double dt) {
     // Run derived class implementation
     run_impl(dt_sub);
 
+    // Time stamps are only updated at the end of the step, but customers
+    // (including the next subcycle of this process) need to know that the
+    // output fields may have changed.
+    mark_fields_out_updated ();
+
     if (m_internal_diagnostics_level > 0)
       print_global_state_hash(name() + "-pst-sc-" + std::to_string(m_subcycle_iter),
                               true, true, true);
@@ -368,6 +373,14 @@ void AtmosphereProcess::run_property_check (const prop_check_ptr&       property
   m_atm_logger->trace("[" + this->name() + "] run_property_check '" + property_check->name() + "'...");
   auto res_and_msg = property_check->check();
 
+  handle_property_check_result(property_check, check_fail_handling, property_check_category, res_and_msg);
+}
+
+void AtmosphereProcess::
+handle_property_check_result (const prop_check_ptr&              property_check,
+                              const CheckFailHandling            check_fail_handling,
+                              const PropertyCheckCategory        property_check_category,
+                              const PropertyCheck::ResultAndMsg& res_and_msg) const {
   // string for output
   std::string pre_post_str;
   if (property_check_category == PropertyCheckCategory::Precondition)  pre_post_str = "pre-condition";
@@ -492,6 +505,25 @@ void AtmosphereProcess::run_column_conservation_check () const {
   m_atm_logger->debug("[" + this->name() + "] run_column-conservation_checks...done!");
 }
 
+void AtmosphereProcess::run_deferred_column_conservation_check () const {
+  const auto& conservation_check =
+      std::dynamic_pointer_cast<MassAndEnergyColumnConservationCheck>(m_column_conservation_check.second);
+  if (not conservation_check->is_deferred()) {
+    return;
+  }
+
+  m_atm_logger->debug("[" + this->name() + "] run_deferred_column_conservation_check...");
+  start_timer(m_timer_prefix + this->name() + "::run-column-conservation-checks");
+  conservation_check->set_current_process(name());
+  auto res_and_msg = conservation_check->check_deferred();
+  handle_property_check_result(m_column_conservation_check.second,
+                               m_column_conservation_check.first,
+                               PropertyCheckCategory::Postcondition,
+                               res_and_msg);
+  stop_timer(m_timer_prefix + this->name() + "::run-column-conservation-checks");
+  m_atm_logger->debug("[" + this->name() + "] run_deferred_column_conservation_check...done!");
+}
+
 void AtmosphereProcess::init_step_tendencies () {
   if (m_compute_proc_tendencies) {
     start_timer(m_timer_prefix + this->name() + "::compute_tendencies");
@@ -578,6 +610,21 @@ void AtmosphereProcess::set_update_time_stamps (const bool do_update) {
   m_update_time_stamps = do_update;
 }
 
+void AtmosphereProcess::mark_fields_out_updated () {
+  for (auto& f : m_fields_out) {
+    f.get_header().get_tracking().mark_updated();
+  }
+  for (auto& g : m_groups_out) {
+    if (g.m_bundle) {
+      g.m_bundle->get_header().get_tracking().mark_updated();
+    } else {
+      for (auto& f : g.m_fields) {
+        f.second->get_header().get_tracking().mark_updated();
+      }
+    }
+  }
+}
+
 void AtmosphereProcess::update_time_stamps () {
   const auto& t = timestamp();
 
@@ -1110,9 +1157,9 @@ void AtmosphereProcess::compute_column_conservation_checks_data (const int dt)
   // Set dt and compute current mass and energy.
   const auto& conservation_check =
       std::dynamic_pointer_cast<MassAndEnergyColumnConservationCheck>(m_column_conservation_check.second);
+  conservation_check->set_current_process(name());
   conservation_check->set_dt(dt);
-  conservation_check->compute_current_mass();
-  conservation_check->compute_current_energy();
+  conservation_check->compute_current_mass_and_energy();
 }
 
 } // namespace scream
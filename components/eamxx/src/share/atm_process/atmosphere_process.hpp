@@ -155,6 +155,10 @@ public:
   void run_postcondition_checks () const;
   void run_column_conservation_check () const;
 
+  // In deferred mode, the column conservation check only accumulates errors
+  // while the process runs. This tests them, and handles failures as above.
+  void run_deferred_column_conservation_check () const;
+
   // Returns pre/postcondition checks
   std::list<std::pair<CheckFailHandling,prop_check_ptr>>
   get_precondition_checks () {
@@ -426,8 +430,9 @@ protected:
   // This provides access to this process's timestamp.
   const TimeStamp& timestamp() const { return m_time_stamp; }
 
-  // These three methods modify the FieldTracking of the input field (see field_tracking.hpp)
+  // These methods modify the FieldTracking of the input field (see field_tracking.hpp)
   void update_time_stamps ();
+  void mark_fields_out_updated ();
   void add_me_as_provider (const Field& f);
   void add_me_as_customer (const Field& f);
 
@@ -522,6 +527,12 @@ private:
                            const CheckFailHandling     check_fail_handling,
                            const PropertyCheckCategory property_check_category) const;
 
+  // Handle the result of a property check (repair, warn, or error out)
+  void handle_property_check_result (const prop_check_ptr&              property_check,
+                                     const CheckFailHandling            check_fail_handling,
+                                     const PropertyCheckCategory        property_check_category,
+                                     const PropertyCheck::ResultAndMsg& res_and_msg) const;
+
   // NOTE: all these members are private, so that derived classes cannot
   //       bypass checks from the base class by accessing the members directly.
   //       Instead, they are forced to use access function, which include
@@ -2,6 +2,7 @@
 #include "share/field/field_utils.hpp"
 
 #include "share/property_checks/field_nan_check.hpp"
+#include "share/property_checks/fused_fields_check.hpp"
 
 #include "ekat/std_meta/ekat_std_utils.hpp"
 #include "ekat/util/ekat_string_utils.hpp"
@@ -318,29 +319,59 @@ setup_column_conservation_checks (const std::shared_ptr<MassAndEnergyColumnConse
                      "within the process, set to 0.\n");
 
     // If all conditions are satisfied, add as postcondition_check
+    conservation_check->register_process(atm_proc->name());
     atm_proc->add_column_conservation_check(conservation_check, fail_handling_type);
   }
 }
 
+void AtmosphereProcessGroup::run_deferred_column_conservation_checks () const
+{
+  for (auto atm_proc : m_atm_processes) {
+    auto atm_proc_group = std::dynamic_pointer_cast<AtmosphereProcessGroup>(atm_proc);
+    if (atm_proc_group) {
+      atm_proc_group->run_deferred_column_conservation_checks();
+    } else if (atm_proc->has_column_conservation_check()) {
+      atm_proc->run_deferred_column_conservation_check();
+    }
+  }
+}
+
 void AtmosphereProcessGroup::add_postcondition_nan_checks () const {
   for (auto proc : m_atm_processes) {
     auto group = std::dynamic_pointer_cast<AtmosphereProcessGroup>(proc);
     if (group) {
       group->add_postcondition_nan_checks();
     } else {
+      // Check all (supported) fields of this process with a single fused kernel.
+      // Fields not supported by the fused check get their own FieldNaNCheck.
+      std::list<Field> fused_fields;
+      std::vector<std::shared_ptr<const AbstractGrid>> fused_grids;
+      auto add_nan_check = [&](const Field& f, const std::shared_ptr<const AbstractGrid>& grid) {
+        if (FusedFieldsCheck::supports(f)) {
+          fused_fields.push_back(f);
+          fused_grids.push_back(grid);
+        } else {
+          auto nan_check = std::make_shared<FieldNaNCheck>(f,grid);
+          proc->add_postcondition_check(nan_check, CheckFailHandling::Fatal);
+        }
+      };
+
       for (const auto& f : proc->get_fields_out()) {
         const auto& grid_name = f.get_header().get_identifier().get_grid_name();
-        auto nan_check = std::make_shared<FieldNaNCheck>(f,m_grids_mgr->get_grid(grid_name));
-        proc->add_postcondition_check(nan_check, CheckFailHandling::Fatal);
+        add_nan_check(f,m_grids_mgr->get_grid(grid_name));
       }
 
       for (const auto& g : proc->get_groups_out()) {
         const auto& grid = m_grids_mgr->get_grid(g.grid_name());
         for (const auto& f : g.m_fields) {
-          auto nan_check = std::make_shared<FieldNaNCheck>(*f.second,grid);
-          proc->add_postcondition_check(nan_check, CheckFailHandling::Fatal);
+          add_nan_check(*f.second,grid);
         }
       }
+
+      if (fused_fields.size()>0) {
+        auto fused_check = std::make_shared<FusedFieldsCheck>(fused_fields,fused_grids);
+        proc->add_postcondition_check(fused_check, CheckFailHandling::Fatal);
+      }
     }
   }
 }
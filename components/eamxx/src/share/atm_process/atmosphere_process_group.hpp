@@ -97,6 +97,10 @@ public:
       const std::shared_ptr<MassAndEnergyColumnConservationCheck>& conservation_check,
       const CheckFailHandling                                      fail_handling_type) const;
 
+  // Tests (and resets) the errors accumulated by deferred
+  // conservation checks of all processes during the step.
+  void run_deferred_column_conservation_checks () const;
+
   // Add nan checks after each non-group process, for each computed field.
   // If checks fail, we print all input and output fields of that process
   // (that are on the same grid) at the location of the fail.
@@ -31,6 +31,16 @@ void FieldTracking::update_time_stamp (const TimeStamp& ts) {
   }
 }
 
+void FieldTracking::mark_updated () {
+  ++m_num_updates;
+
+  for (auto it : this->get_children()) {
+    auto c = it.lock();
+    EKAT_REQUIRE_MSG(c, "Error! A weak pointer of a child field expired.\n");
+    c->mark_updated();
+  }
+}
+
 void FieldTracking::invalidate_time_stamp ()
 {
   // Reset the time stamp to an invalid time stamp
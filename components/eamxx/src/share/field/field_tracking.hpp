@@ -10,6 +10,7 @@
 #include "ekat/std_meta/ekat_std_utils.hpp"
 #include "ekat/ekat_assert.hpp"
 
+#include <cstdint>
 #include <memory>   // For std::weak_ptr
 #include <string>
 
@@ -39,6 +40,11 @@ public:
   // Please, notice this is not the OS time stamp (see time_stamp.hpp for details).
   const TimeStamp& get_time_stamp () const { return m_time_stamp; }
 
+  // The number of times the field was (possibly) modified by an atm process.
+  // Unlike the time stamp, this is incremented every time a provider runs,
+  // including subcycles, so it can be used to detect changes within a time step.
+  std::int64_t get_num_updates () const { return m_num_updates; }
+
   //  - provider: can compute the field as an output
   //  - customer: requires the field as an input
   const atm_proc_set_type& get_providers () const { return m_providers; }
@@ -62,6 +68,9 @@ public:
   void update_time_stamp (const TimeStamp& ts);
   void invalidate_time_stamp ();
 
+  // Increment the updates counter. Like update_time_stamp, this recurses on children.
+  void mark_updated ();
+
   // Set/get accumulation interval start
   void set_accum_start_time (const TimeStamp& ts);
   const TimeStamp& get_accum_start_time () const { return m_accum_start; }
@@ -73,6 +82,7 @@ protected:
 
   // Tracking the updates of the field
   TimeStamp         m_time_stamp;
+  std::int64_t      m_num_updates = 0;
 
   // For accumulated vars, the time where the accumulation started
   TimeStamp         m_accum_start;
@@ -1,4 +1,5 @@
 #include "share/grid/abstract_grid.hpp"
+#include "share/grid/spherical_spatial_index.hpp"
 
 #include "share/field/field_utils.hpp"
 
@@ -305,6 +306,10 @@ AbstractGrid::create_geometry_data (const FieldIdentifier& fid)
       "  - geo data layout: " + m_geo_fields.at(name).get_header().get_identifier().get_layout().to_string() + "\n"
       "  - input layout: " + fid.get_layout().to_string() + "\n");
 
+  if (name=="lat" or name=="lon") {
+    m_spatial_index = nullptr;
+  }
+
   // Create field and the read only copy as well
   auto& f = m_geo_fields[name] = Field(fid);
   f.allocate_view();
@@ -320,6 +325,9 @@ AbstractGrid::delete_geometry_data (const std::string& name)
       "  - geo data name: " + name + "\n");
 
   m_geo_fields.erase(name);
+  if (name=="lat" or name=="lon") {
+    m_spatial_index = nullptr;
+  }
 }
 
 void
@@ -331,6 +339,37 @@ AbstractGrid::set_geometry_data (const Field& f) const
       "  - geo data name: " + f.name() + "\n");
 
   m_geo_fields[f.name()] = f;
+  if (f.name()=="lat" or f.name()=="lon") {
+    m_spatial_index = nullptr;
+  }
+}
+
+std::shared_ptr<const SphericalSpatialIndex>
+AbstractGrid::get_spatial_index () const
+{
+  if (m_spatial_index) {
+    return m_spatial_index;
+  }
+
+  EKAT_REQUIRE_MSG (has_geometry_data("lat") and has_geometry_data("lon"),
+      "Error! Cannot build spatial index, since lat/lon geometry data is missing.\n"
+      "  - grid name: " + this->name() + "\n");
+
+  std::vector<Real> lat_lon[2];
+  const std::string names[2] = {"lat","lon"};
+  for (int i=0; i<2; ++i) {
+    const auto& f = m_geo_fields.at(names[i]);
+    EKAT_REQUIRE_MSG (f.get_header().get_identifier().get_layout().size()==m_num_local_dofs,
+        "Error! Cannot build spatial index, since " + names[i] + " is not a 2d scalar field.\n"
+        "  - grid name: " + this->name() + "\n"
+        "  - layout   : " + f.get_header().get_identifier().get_layout().to_string() + "\n");
+    f.sync_to_host();
+    const auto data = f.get_internal_view_data<const Real,Host>();
+    lat_lon[i].assign(data,data+m_num_local_dofs);
+  }
+
+  m_spatial_index = std::make_shared<SphericalSpatialIndex>(lat_lon[0],lat_lon[1]);
+  return m_spatial_index;
 }
 
 std::list<std::string>
@@ -15,6 +15,8 @@
 namespace scream
 {
 
+class SphericalSpatialIndex;
+
 /*
  * An interface base class for Grid objects
  *
@@ -157,6 +159,12 @@ public:
   // Get list of currently stored geometry data views
   std::list<std::string> get_geometry_data_names () const;
 
+  // Get a spatial index of the local dofs, to find the dof closest to a given point.
+  // The index is built from the "lat"/"lon" geometry data the first time it is
+  // requested, and stored for later calls. It is reset if lat/lon are
+  // created/set/deleted, but NOT if their values are changed in place.
+  std::shared_ptr<const SphericalSpatialIndex> get_spatial_index () const;
+
   // Creates a copy of this grid. If shallow=true, the copy shares views with
   // *this, otherwise each stored array is deep copied
   virtual std::shared_ptr<AbstractGrid> clone (const std::string& clone_name,
@@ -251,6 +259,9 @@ protected:
 
   mutable std::map<std::string,Field>  m_geo_fields;
 
+  // Lazily built in get_spatial_index
+  mutable std::shared_ptr<const SphericalSpatialIndex> m_spatial_index;
+
   // The MPI comm containing the ranks across which the global mesh is partitioned
   ekat::Comm            m_comm;
 };
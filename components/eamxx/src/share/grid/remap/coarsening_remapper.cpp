@@ -21,11 +21,36 @@ CoarseningRemapper (const grid_ptr_type& src_grid,
  : HorizInterpRemapperBase (src_grid,map_file,InterpType::Coarsen)
  , m_track_mask (track_mask)
 {
-  using namespace ShortFieldTagsNames;
+  if (populate_tgt_grid_geo_data) {
+    this->populate_tgt_grid_geo_data();
+  }
+}
 
+CoarseningRemapper::
+CoarseningRemapper (const grid_ptr_type& src_grid,
+                    const std::string& data_name,
+                    const std::vector<AbstractGrid::gid_type>& rows,
+                    const std::vector<AbstractGrid::gid_type>& cols,
+                    const std::vector<Real>& S,
+                    const bool track_mask,
+                    const bool populate_tgt_grid_geo_data)
+ : HorizInterpRemapperBase (src_grid,data_name,rows,cols,S,InterpType::Coarsen)
+ , m_track_mask (track_mask)
+{
   if (populate_tgt_grid_geo_data) {
-    // Replicate the src grid geo data in the tgt grid. We use this remapper to do
-    // the remapping (if needed), and clean it up afterwards.
+    this->populate_tgt_grid_geo_data();
+  }
+}
+
+void CoarseningRemapper::
+populate_tgt_grid_geo_data ()
+{
+  using namespace ShortFieldTagsNames;
+
+  // Replicate the src grid geo data in the tgt grid. We use this remapper to do
+  // the remapping (if needed), and clean it up afterwards.
+  {
+    const auto& src_grid = m_src_grid;
     const auto& src_geo_data_names = src_grid->get_geometry_data_names();
     registration_begins();
     for (const auto& name : src_geo_data_names) {
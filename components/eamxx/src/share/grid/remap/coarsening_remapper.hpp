@@ -47,6 +47,18 @@ public:
                       const bool track_mask = false,
                       const bool populate_tgt_grid_geo_data = true);
 
+  // Same as above, but the sparse matrix triplets are passed directly, rather than read
+  // from a map file (see HorizRemapperData::build). The data name is used in place of the
+  // map file name to share the remap data across remappers.
+  // This is useful, e.g., to sample fields at a set of columns, which are found at runtime.
+  CoarseningRemapper (const grid_ptr_type& src_grid,
+                      const std::string& data_name,
+                      const std::vector<AbstractGrid::gid_type>& rows,
+                      const std::vector<AbstractGrid::gid_type>& cols,
+                      const std::vector<Real>& S,
+                      const bool track_mask = false,
+                      const bool populate_tgt_grid_geo_data = true);
+
   ~CoarseningRemapper ();
 
 protected:
@@ -62,6 +74,9 @@ protected:
 
   void setup_mpi_data_structures () override;
 
+  // Replicate the src grid geo data in the tgt grid
+  void populate_tgt_grid_geo_data ();
+
   std::vector<int> get_pids_for_recv (const std::vector<int>& send_to_pids) const;
 
   std::map<int,std::vector<int>>
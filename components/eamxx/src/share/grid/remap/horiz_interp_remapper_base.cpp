@@ -38,6 +38,47 @@ HorizInterpRemapperBase (const grid_ptr_type& fine_grid,
   }
   ++data.num_customers;
 
+  setup_from_remap_data(data);
+}
+
+HorizInterpRemapperBase::
+HorizInterpRemapperBase (const grid_ptr_type& fine_grid,
+                         const std::string& data_name,
+                         const std::vector<AbstractGrid::gid_type>& rows,
+                         const std::vector<AbstractGrid::gid_type>& cols,
+                         const std::vector<Real>& S,
+                         const InterpType type)
+ : m_fine_grid(fine_grid)
+ , m_map_file (data_name)
+ , m_type (type)
+ , m_comm (fine_grid->get_comm())
+{
+  // Sanity checks
+  EKAT_REQUIRE_MSG (fine_grid->type()==GridType::Point,
+      "Error! Horizontal interpolatory remap only works on PointGrid grids.\n"
+      "  - fine grid name: " + fine_grid->name() + "\n"
+      "  - fine_grid_type: " + e2str(fine_grid->type()) + "\n");
+  EKAT_REQUIRE_MSG (fine_grid->is_unique(),
+      "Error! HorizInterpRemapperBase requires a unique fine grid.\n");
+
+  // This is a special remapper. We only go in one direction
+  m_bwd_allowed = false;
+
+  // Get the remap data (if not already present, it will be built)
+  auto& data = s_remapper_data[m_map_file];
+  if (data.num_customers==0) {
+    data.build(rows,cols,S,m_fine_grid,m_comm,m_type);
+  }
+  ++data.num_customers;
+
+  setup_from_remap_data(data);
+}
+
+void HorizInterpRemapperBase::
+setup_from_remap_data (const HorizRemapperData& data)
+{
+  const auto& fine_grid = m_fine_grid;
+
   m_row_offsets = data.row_offsets;
   m_col_lids = data.col_lids;
   m_weights = data.weights;
@@ -22,6 +22,16 @@ public:
                            const std::string& map_file,
                            const InterpType type);
 
+  // Same as above, but the sparse matrix triplets are passed directly (see
+  // HorizRemapperData::build). The data name replaces the map file name as the key
+  // used to share the remap data across remappers.
+  HorizInterpRemapperBase (const grid_ptr_type& fine_grid,
+                           const std::string& data_name,
+                           const std::vector<AbstractGrid::gid_type>& rows,
+                           const std::vector<AbstractGrid::gid_type>& cols,
+                           const std::vector<Real>& S,
+                           const InterpType type);
+
   ~HorizInterpRemapperBase ();
 
   FieldLayout create_src_layout (const FieldLayout& tgt_layout) const override;
@@ -70,6 +80,9 @@ protected:
   template<typename T>
   using view_1d = typename KT::template view_1d<T>;
 
+  // Grab the remap data, and set the grids
+  void setup_from_remap_data (const HorizRemapperData& data);
+
   void create_ov_fields ();
 
   void clean_up ();
@@ -109,6 +122,7 @@ public:
 
   // Keep track of this, since we need to tell the remap data repo
   // we are releasing the data for our map file.
+  // If triplets were passed directly, this stores the data name instead.
   std::string     m_map_file;
 
   InterpType      m_type;
@@ -30,6 +30,34 @@ build (const std::string& map_file,
   create_crs_matrix_structures (my_triplets);
 }
 
+void HorizRemapperData::
+build (const std::vector<gid_type>& rows,
+       const std::vector<gid_type>& cols,
+       const std::vector<Real>& S,
+       const std::shared_ptr<const AbstractGrid>& fine_grid_in,
+       const ekat::Comm& comm_in,
+       const InterpType type_in)
+{
+  EKAT_REQUIRE_MSG (rows.size()==cols.size() and rows.size()==S.size(),
+      "Error! Input sparse matrix triplets arrays have different sizes.\n"
+      "  - rows size   : " + std::to_string(rows.size()) + "\n"
+      "  - cols size   : " + std::to_string(cols.size()) + "\n"
+      "  - weights size: " + std::to_string(S.size()) + "\n");
+
+  comm = comm_in;
+  fine_grid = fine_grid_in;
+  type = type_in;
+
+  // Send triplets to the ranks that need them
+  auto my_triplets = gather_my_triplets (rows,cols,S);
+
+  // Create coarse/ov_coarse grids
+  create_coarse_grids (my_triplets);
+
+  // Create crs matrix
+  create_crs_matrix_structures (my_triplets);
+}
+
 auto HorizRemapperData::
 get_my_triplets (const std::string& map_file) const
  -> std::vector<Triplet>
@@ -115,6 +143,17 @@ get_my_triplets (const std::string& map_file) const
     id -= col_offset;
   }
 
+  return gather_my_triplets (rows,cols,S);
+}
+
+auto HorizRemapperData::
+gather_my_triplets (const std::vector<gid_type>& rows,
+                    const std::vector<gid_type>& cols,
+                    const std::vector<Real>& S) const
+ -> std::vector<Triplet>
+{
+  const int nlweights = rows.size();
+
   // Create a grid based on the row gids I read in (may be duplicated across ranks)
   std::vector<gid_type> unique_gids;
   const auto& gids = type==InterpType::Refine ? rows : cols;
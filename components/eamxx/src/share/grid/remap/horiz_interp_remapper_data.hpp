@@ -29,6 +29,16 @@ struct HorizRemapperData {
               const ekat::Comm& comm,
               const InterpType type);
 
+  // Same as above, but the sparse matrix triplets are passed directly, rather than
+  // read from a map file. Each rank can pass any subset of the triplets (e.g., the
+  // ones it computed), with row/col ids already matching the gids of the grids.
+  void build (const std::vector<AbstractGrid::gid_type>& rows,
+              const std::vector<AbstractGrid::gid_type>& cols,
+              const std::vector<Real>& S,
+              const std::shared_ptr<const AbstractGrid>& fine_grid,
+              const ekat::Comm& comm,
+              const InterpType type);
+
   // The coarse grid data
   std::shared_ptr<AbstractGrid> coarse_grid;
   std::shared_ptr<AbstractGrid> ov_coarse_grid;
@@ -60,6 +70,12 @@ private:
   std::vector<Triplet>
   get_my_triplets (const std::string& map_file) const;
 
+  // Send each triplet to the rank that owns its fine grid gid
+  std::vector<Triplet>
+  gather_my_triplets (const std::vector<gid_type>& rows,
+                      const std::vector<gid_type>& cols,
+                      const std::vector<Real>& S) const;
+
   void create_coarse_grids (const std::vector<Triplet>& triplets);
 
   // Not a const ref, since we'll sort the triplets according to
@@ -5,7 +5,9 @@
 
 #include <ekat/kokkos/ekat_kokkos_utils.hpp>
 #include <ekat/ekat_pack_utils.hpp>
+#include <ekat/std_meta/ekat_std_utils.hpp>
 
+#include <map>
 #include <numeric>
 
 namespace scream
@@ -27,37 +29,23 @@ RefiningRemapperRMA::
 
 void RefiningRemapperRMA::do_remap_fwd ()
 {
-  // Start RMA epoch on each field
-  for (int i=0; i<m_num_fields; ++i) {
-    check_mpi_call(MPI_Win_post(m_mpi_group,0,m_mpi_win[i]),
-                   "MPI_Win_post for field: " + m_src_fields[i].name());
-    check_mpi_call(MPI_Win_start(m_mpi_group,0,m_mpi_win[i]),
-                   "MPI_Win_start for field: " + m_src_fields[i].name());
-  }
+  // Start the RMA epoch (all fields are in the same window)
+  check_mpi_call(MPI_Win_post(m_mpi_group,0,m_mpi_win),"MPI_Win_post");
+  check_mpi_call(MPI_Win_start(m_mpi_group,0,m_mpi_win),"MPI_Win_start");
 
-  // Loop over fields, and grab data
+  // Loop over fields, and grab data, with one get per remote pid
   constexpr HostOrDevice MpiDev = MpiOnDev ? Device : Host;
-  const auto& dt = ekat::get_mpi_type<Real>();
   for (int i=0; i<m_num_fields; ++i) {
-    const int col_size = m_col_size[i];
-    const int col_stride = m_col_stride[i];
-    const int col_offset = m_col_offset[i];
-    const auto& win = m_mpi_win[i];
     auto ov_data = m_ov_fields[i].get_internal_view_data<Real,MpiDev>();
-    for (int icol=0; icol<m_ov_coarse_grid->get_num_local_dofs(); ++icol) {
-      const int pid = m_remote_pids[icol];
-      const int lid = m_remote_lids[icol];
-      check_mpi_call(MPI_Get(ov_data+icol*col_size,col_size,dt,pid,
-                             lid*col_stride+col_offset,col_size,dt,win),
+    for (const auto& g : m_gets[i]) {
+      check_mpi_call(MPI_Get(ov_data,1,g.origin_type,g.pid,
+                             g.target_disp,1,g.target_type,m_mpi_win),
                      "MPI_Get for field: " + m_ov_fields[i].name());
     }
   }
 
-  // Close access RMA epoch on each field (exposure is still open)
-  for (int i=0; i<m_num_fields; ++i) {
-    check_mpi_call(MPI_Win_complete(m_mpi_win[i]),
-                   "MPI_Win_complete for field: " + m_ov_fields[i].name());
-  }
+  // Close access RMA epoch (exposure is still open)
+  check_mpi_call(MPI_Win_complete(m_mpi_win),"MPI_Win_complete");
 
   // Helpef function, to establish if a field can be handled with packs
   auto can_pack_field = [](const Field& f) {
@@ -89,11 +77,8 @@ void RefiningRemapperRMA::do_remap_fwd ()
     }
   }
 
-  // Close exposure RMA epoch on each field
-  for (int i=0; i<m_num_fields; ++i) {
-    check_mpi_call(MPI_Win_wait(m_mpi_win[i]),
-                   "MPI_Win_post for field: " + m_src_fields[i].name());
-  }
+  // Close exposure RMA epoch
+  check_mpi_call(MPI_Win_wait(m_mpi_win),"MPI_Win_wait");
 }
 
 void RefiningRemapperRMA::setup_mpi_data_structures ()
@@ -111,8 +96,16 @@ void RefiningRemapperRMA::setup_mpi_data_structures ()
   // TODO: scope out possibility of using sub-groups for start/post calls
   //       (but I'm afraid you can't, b/c start/post may require same groups)
 
+  // Create the dynamic window, where we attach all fields
+  check_mpi_call(MPI_Win_create_dynamic(MPI_INFO_NULL,mpi_comm,&m_mpi_win),
+                 "[RefiningRemapperRMA::setup_mpi_data_structures] MPI_Win_create_dynamic");
+#ifndef EKAT_MPI_ERRORS_ARE_FATAL
+  check_mpi_call(MPI_Win_set_errhandler(m_mpi_win,MPI_ERRORS_RETURN),
+                 "[RefiningRemapperRMA::setup_mpi_data_structure] setting MPI_ERRORS_RETURN handler on MPI_Win");
+#endif
+
   // Create per-field structures
-  m_mpi_win.resize(m_num_fields);
+  std::vector<MPI_Aint> my_addr(m_num_fields);
   m_col_size.resize(m_num_fields);
   m_col_stride.resize(m_num_fields);
   m_col_offset.resize(m_num_fields,0);
@@ -137,14 +130,61 @@ void RefiningRemapperRMA::setup_mpi_data_structures ()
       win_size *= sv_info.dim_extent;
     }
 
+    // Subfields of the same parent share the memory, which must be attached only once
     auto data = f.get_internal_view_data<Real,Host>();
-    check_mpi_call(MPI_Win_create(data,win_size,sizeof(Real),
-                                  MPI_INFO_NULL,mpi_comm,&m_mpi_win[i]),
-                   "[RefiningRemapperRMA::setup_mpi_data_structures] MPI_Win_create");
-#ifndef EKAT_MPI_ERRORS_ARE_FATAL
-    check_mpi_call(MPI_Win_set_errhandler(m_mpi_win[i],MPI_ERRORS_RETURN),
-                   "[RefiningRemapperRMA::setup_mpi_data_structure] setting MPI_ERRORS_RETURN handler on MPI_Win");
-#endif
+    if (not ekat::contains(m_attached,data)) {
+      check_mpi_call(MPI_Win_attach(m_mpi_win,data,win_size),
+                     "[RefiningRemapperRMA::setup_mpi_data_structures] MPI_Win_attach");
+      m_attached.push_back(data);
+    }
+    check_mpi_call(MPI_Get_address(data,&my_addr[i]),
+                   "[RefiningRemapperRMA::setup_mpi_data_structures] MPI_Get_address");
+  }
+
+  // With dynamic windows, the target displacement is the address on the remote pid
+  const int nranks = m_comm.size();
+  std::vector<MPI_Aint> all_addr(m_num_fields*nranks);
+  check_mpi_call(MPI_Allgather(my_addr.data(),m_num_fields,MPI_AINT,
+                               all_addr.data(),m_num_fields,MPI_AINT,mpi_comm),
+                 "[RefiningRemapperRMA::setup_mpi_data_structures] MPI_Allgather");
+
+  // For each remote pid, gather the ov cols and the remote lids
+  std::map<int,std::vector<int>> pid2cols, pid2lids;
+  const int num_ov_cols = m_ov_coarse_grid->get_num_local_dofs();
+  for (int icol=0; icol<num_ov_cols; ++icol) {
+    pid2cols[m_remote_pids[icol]].push_back(icol);
+    pid2lids[m_remote_pids[icol]].push_back(m_remote_lids[icol]);
+  }
+
+  // Build the origin/target indexed datatypes for each field and remote pid
+  const auto& dt = ekat::get_mpi_type<Real>();
+  m_gets.resize(m_num_fields);
+  for (int i=0; i<m_num_fields; ++i) {
+    const int col_size = m_col_size[i];
+    const int col_stride = m_col_stride[i];
+    const int col_offset = m_col_offset[i];
+    for (const auto& it : pid2cols) {
+      const int pid = it.first;
+      const auto& cols = it.second;
+      const auto& lids = pid2lids.at(pid);
+      const int ncols = cols.size();
+      std::vector<int> origin_displ(ncols), target_displ(ncols);
+      for (int j=0; j<ncols; ++j) {
+        origin_displ[j] = cols[j]*col_size;
+        target_displ[j] = lids[j]*col_stride+col_offset;
+      }
+
+      GetInfo g;
+      g.pid = pid;
+      g.target_disp = all_addr[pid*m_num_fields+i];
+      check_mpi_call(MPI_Type_create_indexed_block(ncols,col_size,origin_displ.data(),dt,&g.origin_type),
+                     "[RefiningRemapperRMA::setup_mpi_data_structures] MPI_Type_create_indexed_block");
+      check_mpi_call(MPI_Type_create_indexed_block(ncols,col_size,target_displ.data(),dt,&g.target_type),
+                     "[RefiningRemapperRMA::setup_mpi_data_structures] MPI_Type_create_indexed_block");
+      check_mpi_call(MPI_Type_commit(&g.origin_type),"[RefiningRemapperRMA::setup_mpi_data_structures] MPI_Type_commit");
+      check_mpi_call(MPI_Type_commit(&g.target_type),"[RefiningRemapperRMA::setup_mpi_data_structures] MPI_Type_commit");
+      m_gets[i].push_back(g);
+    }
   }
 }
 
@@ -155,10 +195,21 @@ void RefiningRemapperRMA::clean_up ()
     check_mpi_call(MPI_Group_free(&m_mpi_group),"MPI_Group_free");
     m_mpi_group = MPI_GROUP_NULL;
   }
-  for (auto& win : m_mpi_win) {
-    check_mpi_call(MPI_Win_free(&win),"MPI_Win_free");
+  for (auto& gets : m_gets) {
+    for (auto& g : gets) {
+      check_mpi_call(MPI_Type_free(&g.origin_type),"MPI_Type_free");
+      check_mpi_call(MPI_Type_free(&g.target_type),"MPI_Type_free");
+    }
+  }
+  m_gets.clear();
+  if (m_mpi_win!=MPI_WIN_NULL) {
+    for (auto data : m_attached) {
+      check_mpi_call(MPI_Win_detach(m_mpi_win,data),"MPI_Win_detach");
+    }
+    check_mpi_call(MPI_Win_free(&m_mpi_win),"MPI_Win_free");
+    m_mpi_win = MPI_WIN_NULL;
   }
-  m_mpi_win.clear();
+  m_attached.clear();
   m_remote_pids.clear();
   m_remote_lids.clear();
   m_col_size.clear();
@@ -42,6 +42,11 @@ namespace scream
  * standard since 2.0, but its support is still sub-optimal, due to
  * limited effort in optimizing it by the vendors. Furthermore, as of
  * Oct 2023, RMA operations are not supported by GPU-aware implementations.
+ *
+ * All src fields are attached to a single dynamic window, so that a remap
+ * requires only one RMA epoch. For each field, the columns needed from a
+ * given remote rank are fetched with a single MPI_Get, using indexed
+ * datatypes (for both origin and target) that are built once at setup.
  */
 
 class RefiningRemapperRMA : public HorizInterpRemapperBase
@@ -102,8 +107,20 @@ protected:
   std::vector<int>          m_col_stride;
   std::vector<int>          m_col_offset;
 
-  // One MPI window object for each field
-  std::vector<MPI_Win>      m_mpi_win;
+  // Info for the MPI_Get of all the columns of a field needed from a remote pid
+  struct GetInfo {
+    int           pid;
+    MPI_Aint      target_disp;  // Address of the field data on the remote pid
+    MPI_Datatype  origin_type;  // Selects the columns in the ov field
+    MPI_Datatype  target_type;  // Selects the columns in the remote src field
+  };
+
+  // For each field, the list of gets to perform
+  std::vector<std::vector<GetInfo>>  m_gets;
+
+  // A single dynamic MPI window, where all fields are attached
+  MPI_Win                   m_mpi_win = MPI_WIN_NULL;
+  std::vector<Real*>        m_attached;
 };
 
 } // namespace scream
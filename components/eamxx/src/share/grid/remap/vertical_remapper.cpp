@@ -57,6 +57,7 @@ VerticalRemapper (const grid_ptr_type& src_grid,
   // vertical levels.
   scorpio::register_file(map_file,scorpio::FileMode::Read);
   auto nlevs_tgt = scorpio::get_dimlen(map_file,"lev");
+  m_conservative = scorpio::has_var(map_file,"p_ilevs");
 
   auto tgt_grid = src_grid->clone("vertical_remap_tgt_grid",true);
   tgt_grid->reset_num_vertical_lev(nlevs_tgt);
@@ -71,6 +72,15 @@ VerticalRemapper (const grid_ptr_type& src_grid,
   // Add tgt pressure levels to the tgt grid
   tgt_grid->set_geometry_data(m_tgt_pressure);
 
+  if (m_conservative) {
+    const int ncols = src_grid->get_num_local_dofs();
+    m_cons_beg    = view_2d<int>("cons_beg",ncols,nlevs_tgt);
+    m_cons_end    = view_2d<int>("cons_end",ncols,nlevs_tgt);
+    m_cons_wbeg   = view_2d<Real>("cons_wbeg",ncols,nlevs_tgt);
+    m_cons_wend   = view_2d<Real>("cons_wend",ncols,nlevs_tgt);
+    m_cons_inv_dp = view_2d<Real>("cons_inv_dp",ncols,nlevs_tgt);
+  }
+
   scorpio::release_file(map_file);
 }
 
@@ -153,7 +163,31 @@ set_pressure_levels(const std::string& map_file)
   m_tgt_pressure.allocate_view();
 
   auto remap_pres_data = m_tgt_pressure.get_view<Real*,Host>().data();
-  scorpio::read_var(map_file,"p_levs",remap_pres_data);
+  if (m_conservative) {
+    // Read the layer edges, and use the layer midpoints as tgt levels
+    const int nlevs_tgt = m_tgt_grid->get_num_vertical_levels();
+    EKAT_REQUIRE_MSG (scorpio::get_dimlen(map_file,"ilev")==nlevs_tgt+1,
+        "Error! Vertical remap file 'ilev' dimension must be equal to 'lev' dimension plus one.\n"
+        "  - map file: " + map_file + "\n"
+        "  - lev dim : " + std::to_string(nlevs_tgt) + "\n"
+        "  - ilev dim: " + std::to_string(scorpio::get_dimlen(map_file,"ilev")) + "\n");
+
+    FieldIdentifier ifid("p_ilevs",m_tgt_grid->get_vertical_layout(false),ekat::units::Pa,m_tgt_grid->name());
+    m_tgt_pint = Field(ifid);
+    m_tgt_pint.allocate_view();
+
+    auto pint_h = m_tgt_pint.get_view<Real*,Host>();
+    scorpio::read_var(map_file,"p_ilevs",pint_h.data());
+    for (int k=0; k<nlevs_tgt; ++k) {
+      EKAT_REQUIRE_MSG (pint_h(k)<pint_h(k+1),
+          "Error! Vertical remap file 'p_ilevs' must be strictly increasing.\n"
+          "  - map file: " + map_file + "\n");
+      remap_pres_data[k] = (pint_h(k) + pint_h(k+1)) / 2;
+    }
+    m_tgt_pint.sync_to_dev();
+  } else {
+    scorpio::read_var(map_file,"p_levs",remap_pres_data);
+  }
 
   m_tgt_pressure.sync_to_dev();
 }
@@ -204,6 +238,10 @@ do_register_field (const identifier_type& src, const identifier_type& tgt)
     "  - tgt field name: " + tgt.name() + "\n"
     "  - src field layout: " + src_layout.to_string() + "\n"
     "  - tgt field layout: " + tgt_layout.to_string() + "\n");
+  EKAT_REQUIRE_MSG(not (m_conservative and src.get_layout().has_tag(ILEV)),
+    "[VerticalRemapper] Error! Conservative vertical remap does not support fields at interfaces.\n"
+    "  - src field name: " + src.name() + "\n"
+    "  - src field layout: " + src.get_layout().to_string() + "\n");
 
   m_src_fields.emplace_back(src);
   m_tgt_fields.emplace_back(tgt);
@@ -300,15 +338,84 @@ do_bind_field (const int ifield, const field_type& src, const field_type& tgt)
   }
 
   if (this->m_num_bound_fields==this->m_num_registered_fields) {
-    create_lin_interp ();
+    if (m_conservative) {
+      create_conservative_descs ();
+    } else {
+      create_lin_interp ();
+    }
   }
 }
 
 void VerticalRemapper::do_registration_ends ()
 {
   if (this->m_num_bound_fields==this->m_num_registered_fields) {
-    create_lin_interp ();
+    if (m_conservative) {
+      create_conservative_descs ();
+    } else {
+      create_lin_interp ();
+    }
+  }
+}
+
+void VerticalRemapper::create_conservative_descs()
+{
+  using namespace ShortFieldTagsNames;
+
+  // Gather all fields with a vertical dimension, as well as the masks
+  std::vector<Field> src, tgt;
+  std::vector<Real> mask_vals;
+  for (int i=0; i<m_num_fields; ++i) {
+    if (m_tgt_fields[i].get_header().get_identifier().get_layout().has_tag(LEV)) {
+      src.push_back(m_src_fields[i]);
+      tgt.push_back(m_tgt_fields[i]);
+      mask_vals.push_back(m_mask_val);
+    }
+  }
+  for (size_t i=0; i<m_tgt_masks.size(); ++i) {
+    src.push_back(m_src_masks[i]);
+    tgt.push_back(m_tgt_masks[i]);
+    mask_vals.push_back(0);
+  }
+
+  const int nf = src.size();
+  m_cons_descs = view_1d<ConsFieldDesc>("cons_descs",nf);
+  auto descs_h = Kokkos::create_mirror_view(m_cons_descs);
+  for (int i=0; i<nf; ++i) {
+    auto& d = descs_h(i);
+    d.mask_val = mask_vals[i];
+    switch (src[i].rank()) {
+      case 2:
+      {
+        auto sv = src[i].get_strided_view<const Real**>();
+        auto tv = tgt[i].get_strided_view<      Real**>();
+        d.src = sv.data();
+        d.tgt = tv.data();
+        d.ncmps = 1;
+        d.src_strides[0] = sv.stride(0); d.src_strides[1] = 0; d.src_strides[2] = sv.stride(1);
+        d.tgt_strides[0] = tv.stride(0); d.tgt_strides[1] = 0; d.tgt_strides[2] = tv.stride(1);
+        break;
+      }
+      case 3:
+      {
+        auto sv = src[i].get_strided_view<const Real***>();
+        auto tv = tgt[i].get_strided_view<      Real***>();
+        d.src = sv.data();
+        d.tgt = tv.data();
+        d.ncmps = sv.extent(1);
+        for (int k=0; k<3; ++k) {
+          d.src_strides[k] = sv.stride(k);
+          d.tgt_strides[k] = tv.stride(k);
+        }
+        break;
+      }
+      default:
+        EKAT_ERROR_MSG (
+            "[VerticalRemapper::create_conservative_descs] Error! Unsupported field rank.\n"
+            " - src field name: " + src[i].name() + "\n"
+            " - src field rank: " + std::to_string(src[i].rank()) + "\n");
+    }
   }
+  Kokkos::deep_copy(m_cons_descs,descs_h);
 }
 
 void VerticalRemapper::create_lin_interp()
@@ -363,6 +470,12 @@ void VerticalRemapper::create_lin_interp()
 
 void VerticalRemapper::do_remap_fwd ()
 {
+  if (m_conservative) {
+    // Compute this step's overlap weights, then remap all fields (and masks) at once
+    compute_conservative_weights ();
+    apply_conservative_average ();
+  }
+
   // 1. Setup any interp object that was created (if nullptr, no fields need it)
   if (m_lin_interp_mid_packed) {
     setup_lin_interp(*m_lin_interp_mid_packed,m_src_pmid);
@@ -385,6 +498,10 @@ void VerticalRemapper::do_remap_fwd ()
           auto& f_tgt    = m_tgt_fields[i];
     const auto& tgt_layout   = f_tgt.get_header().get_identifier().get_layout();
     if (tgt_layout.has_tag(LEV)) {
+      if (m_conservative) {
+        // Already done above
+        continue;
+      }
       const auto& type = m_field2type.at(f_src.name());
       // Dispatch interpolation to the proper lin interp object
       if (type.midpoints) {
@@ -413,8 +530,8 @@ void VerticalRemapper::do_remap_fwd ()
     }
   }
 
-  // 3. Interpolate the mask fields
-  for (unsigned i=0; i<m_tgt_masks.size(); ++i) {
+  // 3. Interpolate the mask fields (in conservative mode, they were already remapped)
+  for (unsigned i=0; i<m_tgt_masks.size() and not m_conservative; ++i) {
           auto& f_src = m_src_masks[i];
           auto& f_tgt = m_tgt_masks[i];
     const auto& type = m_field2type.at(f_src.name());
@@ -436,6 +553,123 @@ void VerticalRemapper::do_remap_fwd ()
   }
 }
 
+void VerticalRemapper::
+compute_conservative_weights () const
+{
+  using ESU = ekat::ExeSpaceUtils<DefaultDevice::execution_space>;
+  using MemberType = typename KT::MemberType;
+
+  auto p_src = m_src_pint.get_view<const Real**>();
+  auto p_tgt = m_tgt_pint.get_view<const Real*>();
+  auto beg    = m_cons_beg;
+  auto end    = m_cons_end;
+  auto wbeg   = m_cons_wbeg;
+  auto wend   = m_cons_wend;
+  auto inv_dp = m_cons_inv_dp;
+
+  const int ncols = m_src_grid->get_num_local_dofs();
+  const int nlevs_src = m_src_grid->get_num_vertical_levels();
+  const int nlevs_tgt = m_tgt_grid->get_num_vertical_levels();
+
+  auto lambda = KOKKOS_LAMBDA(const MemberType& team) {
+    const int icol = team.league_rank();
+    auto pint = ekat::subview(p_src,icol);
+    auto overlap = [&](const int j, const Real top, const Real bot) -> Real {
+      const Real t = pint(j)>top ? pint(j) : top;
+      const Real b = pint(j+1)<bot ? pint(j+1) : bot;
+      return b>t ? b-t : 0;
+    };
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team,nlevs_tgt),[&](const int k) {
+      const Real top = p_tgt(k);
+      const Real bot = p_tgt(k+1);
+
+      // First src layer whose bottom edge is below the top of the tgt layer
+      int lo = 0, hi = nlevs_src;
+      while (lo<hi) {
+        const int mid = (lo+hi)/2;
+        if (pint(mid+1)>top) { hi = mid; } else { lo = mid+1; }
+      }
+      const int jbeg = lo;
+
+      // First src layer whose top edge is not above the bottom of the tgt layer
+      hi = nlevs_src;
+      while (lo<hi) {
+        const int mid = (lo+hi)/2;
+        if (pint(mid)>=bot) { hi = mid; } else { lo = mid+1; }
+      }
+      const int jend = lo;
+
+      beg(icol,k) = jbeg;
+      end(icol,k) = jend;
+      if (jend>jbeg) {
+        const Real t = pint(0)>top ? pint(0) : top;
+        const Real b = pint(nlevs_src)<bot ? pint(nlevs_src) : bot;
+        wbeg(icol,k) = overlap(jbeg,top,bot);
+        wend(icol,k) = overlap(jend-1,top,bot);
+        inv_dp(icol,k) = 1 / (b-t);
+      } else {
+        // The tgt layer is completely outside the src column
+        wbeg(icol,k) = wend(icol,k) = inv_dp(icol,k) = 0;
+      }
+    });
+  };
+
+  auto policy = ESU::get_default_team_policy(ncols,nlevs_tgt);
+  Kokkos::parallel_for("VerticalRemapper::compute_conservative_weights",policy,lambda);
+}
+
+void VerticalRemapper::
+apply_conservative_average () const
+{
+  using ESU = ekat::ExeSpaceUtils<DefaultDevice::execution_space>;
+  using MemberType = typename KT::MemberType;
+
+  auto p_src  = m_src_pint.get_view<const Real**>();
+  auto beg    = m_cons_beg;
+  auto end    = m_cons_end;
+  auto wbeg   = m_cons_wbeg;
+  auto wend   = m_cons_wend;
+  auto inv_dp = m_cons_inv_dp;
+  auto descs  = m_cons_descs;
+
+  const int nf = descs.extent(0);
+  const int ncols = m_src_grid->get_num_local_dofs();
+  const int nlevs_tgt = m_tgt_grid->get_num_vertical_levels();
+  if (nf==0) {
+    return;
+  }
+
+  auto lambda = KOKKOS_LAMBDA(const MemberType& team) {
+    const int icol = team.league_rank() / nf;
+    const auto& d  = descs(team.league_rank() % nf);
+    auto pint = ekat::subview(p_src,icol);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team,d.ncmps*nlevs_tgt),[&](const int idx) {
+      const int icmp = idx / nlevs_tgt;
+      const int k    = idx % nlevs_tgt;
+      const Real* y_src = d.src + icol*d.src_strides[0] + icmp*d.src_strides[1];
+      const int   s     = d.src_strides[2];
+      Real& y_tgt = d.tgt[icol*d.tgt_strides[0] + icmp*d.tgt_strides[1] + k*d.tgt_strides[2]];
+
+      const int jbeg = beg(icol,k);
+      const int jend = end(icol,k);
+      if (jend==jbeg) {
+        y_tgt = d.mask_val;
+      } else if (jend==jbeg+1) {
+        y_tgt = y_src[jbeg*s];
+      } else {
+        Real sum = wbeg(icol,k)*y_src[jbeg*s] + wend(icol,k)*y_src[(jend-1)*s];
+        for (int j=jbeg+1; j<jend-1; ++j) {
+          sum += (pint(j+1)-pint(j))*y_src[j*s];
+        }
+        y_tgt = sum*inv_dp(icol,k);
+      }
+    });
+  };
+
+  auto policy = ESU::get_default_team_policy(ncols*nf,nlevs_tgt);
+  Kokkos::parallel_for("VerticalRemapper::apply_conservative_average",policy,lambda);
+}
+
 template<int Packsize>
 void VerticalRemapper::
 setup_lin_interp (const ekat::LinInterp<Real,Packsize>& lin_interp,
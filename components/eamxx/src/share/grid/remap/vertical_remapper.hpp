@@ -10,6 +10,16 @@ namespace scream
 
 /*
  * A remapper to interpolate fields on a separate vertical grid
+ *
+ * By default, fields are linearly interpolated (in pressure) at the
+ * levels stored in the map file variable "p_levs".
+ * If the map file also contains the variable "p_ilevs" (the edges of the
+ * tgt layers, with dimension "ilev"), the remapper works in conservative
+ * mode instead: each tgt layer value is the average of the src midpoint
+ * values, weighted by the pressure thickness (i.e., the mass) of the
+ * overlap between src and tgt layers. The weights are computed once per
+ * remap call, and all fields are averaged with a single kernel. In this
+ * mode, fields at interfaces (ILEV) are not supported.
  */
 
 class VerticalRemapper : public AbstractRemapper
@@ -30,6 +40,8 @@ public:
 
   ~VerticalRemapper () = default;
 
+  bool is_conservative () const { return m_conservative; }
+
   FieldLayout create_src_layout (const FieldLayout& tgt_layout) const override;
   FieldLayout create_tgt_layout (const FieldLayout& src_layout) const override;
 
@@ -105,10 +117,14 @@ public:
   template<int N>
   void setup_lin_interp (const ekat::LinInterp<Real,N>& lin_interp,
                          const Field& p_src) const;
+
+  void compute_conservative_weights () const;
+  void apply_conservative_average () const;
 protected:
 
   void set_source_pressure_fields(const Field& pmid, const Field& pint);
   void create_lin_interp ();
+  void create_conservative_descs ();
   
   using KT = KokkosTypes<DefaultDevice>;
 
@@ -145,6 +161,31 @@ protected:
   std::shared_ptr<ekat::LinInterp<Real,SCREAM_PACK_SIZE>> m_lin_interp_int_packed;
   std::shared_ptr<ekat::LinInterp<Real,1>>                m_lin_interp_mid_scalar;
   std::shared_ptr<ekat::LinInterp<Real,1>>                m_lin_interp_int_scalar;
+
+  // Conservative mode data
+  bool                  m_conservative = false;
+  Field                 m_tgt_pint;  // Edges of the tgt layers
+
+  // For each (col,tgt lev): the range [beg,end) of overlapping src levels,
+  // the overlap with the first/last of them, and 1/(total overlap).
+  // The overlap with the src levels in between is their full thickness.
+  view_2d<int>          m_cons_beg;
+  view_2d<int>          m_cons_end;
+  view_2d<Real>         m_cons_wbeg;
+  view_2d<Real>         m_cons_wend;
+  view_2d<Real>         m_cons_inv_dp;
+
+  // Device description of a field to remap, so that we can process all
+  // fields in one kernel. Strides are for (col,cmp,lev)
+  struct ConsFieldDesc {
+    const Real* src;
+    Real*       tgt;
+    int         ncmps;
+    int         src_strides[3];
+    int         tgt_strides[3];
+    Real        mask_val;
+  };
+  view_1d<ConsFieldDesc>  m_cons_descs;
 };
 
 } // namespace scream
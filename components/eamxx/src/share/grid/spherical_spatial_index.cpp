@@ -0,0 +1,208 @@
+#include "share/grid/spherical_spatial_index.hpp"
+
+#include <ekat/ekat_assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace scream
+{
+
+SphericalSpatialIndex::
+SphericalSpatialIndex (const std::vector<Real>& lat,
+                       const std::vector<Real>& lon)
+{
+  EKAT_REQUIRE_MSG (lat.size()==lon.size(),
+      "Error! Input lat/lon arrays have different sizes.\n"
+      "  - lat size: " + std::to_string(lat.size()) + "\n"
+      "  - lon size: " + std::to_string(lon.size()) + "\n");
+
+  const int n = lat.size();
+  m_points.resize(n);
+  for (int i=0; i<n; ++i) {
+    m_points[i] = to_unit_vector(lat[i],lon[i]);
+  }
+
+  m_perm.resize(n);
+  m_axis.resize(n);
+  std::iota(m_perm.begin(),m_perm.end(),0);
+  build(0,n);
+}
+
+int SphericalSpatialIndex::
+closest (const Real lat, const Real lon, Real& dist) const
+{
+  int best = -1;
+  double best_d2 = std::numeric_limits<double>::max();
+  search(to_unit_vector(lat,lon),0,size(),best,best_d2);
+
+  if (best<0) {
+    dist = std::numeric_limits<Real>::max();
+  } else {
+    // Chord length c and angle t are related by c = 2*sin(t/2)
+    const double half_chord = std::min(std::sqrt(best_d2)/2,1.0);
+    dist = 2*std::asin(half_chord);
+  }
+  return best;
+}
+
+void SphericalSpatialIndex::
+closest (const std::vector<Real>& lat,
+         const std::vector<Real>& lon,
+         std::vector<int>&  idx,
+         std::vector<Real>& dist) const
+{
+  EKAT_REQUIRE_MSG (lat.size()==lon.size(),
+      "Error! Input lat/lon arrays have different sizes.\n"
+      "  - lat size: " + std::to_string(lat.size()) + "\n"
+      "  - lon size: " + std::to_string(lon.size()) + "\n");
+
+  const int n = lat.size();
+  idx.resize(n);
+  dist.resize(n);
+
+  // Queries only read the tree, so they can be done concurrently
+  using policy_t = Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>;
+  Kokkos::parallel_for(policy_t(0,n), [&](const int i) {
+    idx[i] = closest(lat[i],lon[i],dist[i]);
+  });
+  Kokkos::fence();
+}
+
+Real SphericalSpatialIndex::
+distance (const Real lat1, const Real lon1,
+          const Real lat2, const Real lon2)
+{
+  const auto p = to_unit_vector(lat1,lon1);
+  const auto q = to_unit_vector(lat2,lon2);
+  const double cx = p[1]*q[2] - p[2]*q[1];
+  const double cy = p[2]*q[0] - p[0]*q[2];
+  const double cz = p[0]*q[1] - p[1]*q[0];
+  const double dot = p[0]*q[0] + p[1]*q[1] + p[2]*q[2];
+  return std::atan2(std::sqrt(cx*cx+cy*cy+cz*cz),dot);
+}
+
+auto SphericalSpatialIndex::
+to_unit_vector (const Real lat, const Real lon) -> point_t
+{
+  constexpr double deg2rad = M_PI / 180.0;
+  const double lat_r = lat*deg2rad;
+  const double lon_r = lon*deg2rad;
+  return point_t{ std::cos(lat_r)*std::cos(lon_r),
+                  std::cos(lat_r)*std::sin(lon_r),
+                  std::sin(lat_r) };
+}
+
+void SphericalSpatialIndex::
+build (const int beg, const int end)
+{
+  if (end-beg<=0) {
+    return;
+  }
+  const int mid = (beg+end)/2;
+
+  // Split along the axis with largest extent
+  point_t lo, hi;
+  lo.fill( std::numeric_limits<double>::max());
+  hi.fill(-std::numeric_limits<double>::max());
+  for (int i=beg; i<end; ++i) {
+    const auto& p = m_points[m_perm[i]];
+    for (int d=0; d<3; ++d) {
+      lo[d] = std::min(lo[d],p[d]);
+      hi[d] = std::max(hi[d],p[d]);
+    }
+  }
+  int axis = 0;
+  for (int d=1; d<3; ++d) {
+    if (hi[d]-lo[d] > hi[axis]-lo[axis]) {
+      axis = d;
+    }
+  }
+
+  std::nth_element(m_perm.begin()+beg,m_perm.begin()+mid,m_perm.begin()+end,
+                   [&](const int a, const int b) {
+                     return m_points[a][axis] < m_points[b][axis];
+                   });
+  m_axis[mid] = axis;
+
+  build(beg,mid);
+  build(mid+1,end);
+}
+
+void SphericalSpatialIndex::
+search (const point_t& p, const int beg, const int end,
+        int& best, double& best_d2) const
+{
+  if (end-beg<=0) {
+    return;
+  }
+  const int mid = (beg+end)/2;
+  const int ip  = m_perm[mid];
+  const auto& q = m_points[ip];
+
+  double d2 = 0;
+  for (int d=0; d<3; ++d) {
+    d2 += (p[d]-q[d])*(p[d]-q[d]);
+  }
+  if (d2<best_d2 or (d2==best_d2 and ip<best)) {
+    best = ip;
+    best_d2 = d2;
+  }
+
+  // Visit the side of the split plane containing p first. Visit the other
+  // side only if it may contain a point at least as close as the best one.
+  const int axis = m_axis[mid];
+  const double diff = p[axis]-q[axis];
+  if (diff<0) {
+    search(p,beg,mid,best,best_d2);
+    if (diff*diff<=best_d2) {
+      search(p,mid+1,end,best,best_d2);
+    }
+  } else {
+    search(p,mid+1,end,best,best_d2);
+    if (diff*diff<=best_d2) {
+      search(p,beg,mid,best,best_d2);
+    }
+  }
+}
+
+void find_closest_columns (const AbstractGrid& grid,
+                           const std::vector<Real>& lat,
+                           const std::vector<Real>& lon,
+                           std::vector<int>& pids,
+                           std::vector<int>& lids,
+                           std::vector<Real>* dist)
+{
+  const auto& comm = grid.get_comm();
+  const int n = lat.size();
+
+  // Find the closest local column for each target
+  std::vector<int>  idx;
+  std::vector<Real> local_dist;
+  grid.get_spatial_index()->closest(lat,lon,idx,local_dist);
+
+  // Find the rank with the closest column, for all targets at once.
+  // In case of ties, MINLOC picks the lowest rank.
+  std::vector<std::pair<Real,int>> dist_and_rank(n);
+  for (int i=0; i<n; ++i) {
+    dist_and_rank[i] = {local_dist[i],comm.rank()};
+  }
+  comm.all_reduce<std::pair<Real,int>>(dist_and_rank.data(),n,MPI_MINLOC);
+
+  pids.resize(n);
+  lids.resize(n);
+  if (dist) {
+    dist->resize(n);
+  }
+  for (int i=0; i<n; ++i) {
+    pids[i] = dist_and_rank[i].second;
+    lids[i] = pids[i]==comm.rank() ? idx[i] : -1;
+    if (dist) {
+      (*dist)[i] = dist_and_rank[i].first;
+    }
+  }
+}
+
+} // namespace scream
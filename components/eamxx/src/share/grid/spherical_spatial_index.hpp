@@ -0,0 +1,90 @@
+#ifndef EAMXX_SPHERICAL_SPATIAL_INDEX_HPP
+#define EAMXX_SPHERICAL_SPATIAL_INDEX_HPP
+
+#include "share/grid/abstract_grid.hpp"
+#include "share/scream_types.hpp"
+
+#include <array>
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * A spatial index for a set of points on the sphere, used to find the point
+ * closest to a given target (lat,lon) location.
+ *
+ * Points are stored as unit vectors in R^3, and organized in a (balanced) k-d tree,
+ * so that a query costs O(log N) rather than the O(N) of a brute force search.
+ * Since the chord distance between unit vectors is monotone in the great circle
+ * distance, the closest point in R^3 is also the closest point on the sphere.
+ * Unlike a search on |dlat|+|dlon|, this is not fooled by the longitude periodicity
+ * or by the convergence of meridians at the poles.
+ *
+ * The index is read-only after construction, so queries can be done concurrently.
+ * The batched version of closest() already does the queries in parallel.
+ *
+ * All lat/lon values are in degrees. Distances are great circle distances, in radians.
+ * In case of ties, the point with the smallest index is returned.
+ */
+
+class SphericalSpatialIndex
+{
+public:
+  SphericalSpatialIndex (const std::vector<Real>& lat,
+                         const std::vector<Real>& lon);
+
+  int size () const { return m_points.size(); }
+
+  // Returns the index of the point closest to (lat,lon), and sets dist
+  // to its distance from (lat,lon). If the index is empty, returns -1,
+  // and sets dist to a huge value.
+  int closest (const Real lat, const Real lon, Real& dist) const;
+
+  // Same as above, for a batch of targets. The queries are done in parallel.
+  void closest (const std::vector<Real>& lat,
+                const std::vector<Real>& lon,
+                std::vector<int>&  idx,
+                std::vector<Real>& dist) const;
+
+  // Great circle distance (in radians) between two points on the sphere
+  static Real distance (const Real lat1, const Real lon1,
+                        const Real lat2, const Real lon2);
+
+protected:
+  using point_t = std::array<double,3>;
+
+  static point_t to_unit_vector (const Real lat, const Real lon);
+
+  // Build the subtree for the entries [beg,end) of m_perm
+  void build (const int beg, const int end);
+
+  // Search the subtree for entries [beg,end) of m_perm, updating best/best_d2
+  void search (const point_t& p, const int beg, const int end,
+               int& best, double& best_d2) const;
+
+  std::vector<point_t>  m_points;
+
+  // The tree is implicit: the node for the range [beg,end) of m_perm is the
+  // midpoint mid=(beg+end)/2, with children [beg,mid) and [mid+1,end).
+  // m_perm(mid) is the index of the node point, and m_axis(mid) its split axis.
+  std::vector<int>      m_perm;
+  std::vector<char>     m_axis;
+};
+
+// For each target (lat,lon), find the column of the grid closest to it, among all ranks.
+// On output, for each target, pids[i] is the rank owning the closest column, and
+// lids[i] is its local index on that rank (and -1 on all other ranks).
+// If dist is not null, it is filled with the distance (in radians) of the closest column.
+// The grid must have "lat" and "lon" geometry data. This uses the grid spatial index
+// (see AbstractGrid::get_spatial_index), and a single MPI reduction for all targets.
+void find_closest_columns (const AbstractGrid& grid,
+                           const std::vector<Real>& lat,
+                           const std::vector<Real>& lon,
+                           std::vector<int>& pids,
+                           std::vector<int>& lids,
+                           std::vector<Real>* dist = nullptr);
+
+} // namespace scream
+
+#endif // EAMXX_SPHERICAL_SPATIAL_INDEX_HPP
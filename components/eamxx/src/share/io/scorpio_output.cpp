@@ -3,6 +3,7 @@
 #include "share/util/scream_array_utils.hpp"
 #include "share/grid/remap/coarsening_remapper.hpp"
 #include "share/grid/remap/vertical_remapper.hpp"
+#include "share/grid/spherical_spatial_index.hpp"
 #include "share/util/scream_timing.hpp"
 #include "share/field/field_utils.hpp"
 
@@ -12,6 +13,9 @@
 
 #include <numeric>
 #include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <limits>
 
 namespace scream
 {
@@ -113,9 +117,11 @@ AtmosphereOutput (const ekat::Comm& comm,
 AtmosphereOutput::
 AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
                   const std::shared_ptr<const fm_type>& field_mgr,
-                  const std::shared_ptr<const gm_type>& grids_mgr)
- : m_comm         (comm)
- , m_add_time_dim (true)
+                  const std::shared_ptr<const gm_type>& grids_mgr,
+                  const std::shared_ptr<DiagnosticsRegistry>& diags_registry)
+ : m_comm           (comm)
+ , m_diags_registry (diags_registry)
+ , m_add_time_dim   (true)
 {
   using vos_t = std::vector<std::string>;
 
@@ -176,16 +182,23 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
   //   - online remapping which is setup using the create_remapper function
   const bool use_vertical_remap_from_file = params.isParameter("vertical_remap_file");
   const bool use_horiz_remap_from_file = params.isParameter("horiz_remap_file");
+  const bool use_station_output = params.isSublist("stations");
   const bool use_online_remapper = io_grid->name()!=fm_grid->name();  // TODO: QUESTION, Do we anticipate online remapping w/ horiz_remap_from file?
   // Check that we are not requesting online remapping w/ horiz and/or vertical remapping.  Which is not currently supported.
   if (use_online_remapper) {
-    EKAT_REQUIRE_MSG(!use_vertical_remap_from_file and !use_horiz_remap_from_file,"ERROR: scorpio_output - online remapping not supported with vertical and/or horizontal remapping from file");
+    EKAT_REQUIRE_MSG(!use_vertical_remap_from_file and !use_horiz_remap_from_file and !use_station_output,"ERROR: scorpio_output - online remapping not supported with vertical and/or horizontal remapping from file, or with station output");
   }
+  EKAT_REQUIRE_MSG(!use_horiz_remap_from_file or !use_station_output,
+      "ERROR: scorpio_output - horizontal remapping from file not supported with station output");
 
   // Try to set the IO grid (checks will be performed)
   set_grid (io_grid);
 
-  // Register any diagnostics needed by this output stream
+  // Register any diagnostics needed by this output stream. If no registry was
+  // provided, use a private one, so diags are not shared with other streams.
+  if (not m_diags_registry) {
+    m_diags_registry = std::make_shared<DiagnosticsRegistry>();
+  }
   set_diagnostics();
 
   // Avg count only makes sense if we have
@@ -271,7 +284,7 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
   }
 
   // Online remapper and horizontal remapper follow a similar pattern so we check in the same conditional.
-  if (use_online_remapper || use_horiz_remap_from_file) {
+  if (use_online_remapper || use_horiz_remap_from_file || use_station_output) {
 
     // Whic FM is the one pre-horiz-remap depends on whether we did vert remap or not
     const auto fm_pre_hremap = use_vertical_remap_from_file
@@ -286,6 +299,11 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
       m_horiz_remapper = std::make_shared<CoarseningRemapper>(io_grid,horiz_remap_file,true);
       io_grid = m_horiz_remapper->get_tgt_grid();
       set_grid(io_grid);
+    } else if (use_station_output) {
+      // Construct a coarsening remapper that samples the stations columns
+      m_horiz_remapper = create_station_remapper(params.sublist("stations"),io_grid);
+      io_grid = m_horiz_remapper->get_tgt_grid();
+      set_grid(io_grid);
     } else {
       // Construct a generic remapper (likely, SE->Point)
       m_horiz_remapper = grids_mgr->create_remapper(fm_grid,io_grid);
@@ -365,7 +383,10 @@ void AtmosphereOutput::
 init_timestep (const util::TimeStamp& start_of_step)
 {
   for (auto& it : m_diagnostics) {
-    it.second->init_timestep(start_of_step);
+    // Diags shared with other streams may have already been inited for this step
+    if (m_diags_registry->needs_init_timestep(it.second.get(),start_of_step)) {
+      it.second->init_timestep(start_of_step);
+    }
   }
 }
 
@@ -373,7 +394,8 @@ void AtmosphereOutput::
 run (const std::string& filename,
      const bool output_step, const bool checkpoint_step,
      const int nsteps_since_last_output,
-     const bool allow_invalid_fields)
+     const bool allow_invalid_fields,
+     const util::TimeStamp& timestamp)
 {
   // If we do INSTANT output, but this is not an write step,
   // we can immediately return
@@ -383,8 +405,15 @@ run (const std::string& filename,
   }
   Real duration_write = 0.0;  // Record of time spent writing output
   if (is_write_step) {
+    // In deferred mode, the snapshot buffers would be overwritten
+    EKAT_REQUIRE_MSG (not has_pending_writes(),
+        "Error! Output stream has pending writes from a previous write step.\n"
+        "  - pending file name: " + m_pending_filename + "\n"
+        "  - current file name: " + filename + "\n"
+        "Call write_pending(0) before running a new write step.\n");
     if (m_atm_logger) {
-      m_atm_logger->info("[EAMxx::scorpio_output] Writing variables to file");
+      m_atm_logger->info(std::string("[EAMxx::scorpio_output] ") +
+                         (m_deferred_write ? "Snapshotting variables for file" : "Writing variables to file"));
       m_atm_logger->info("  file name: " + filename);
     }
   }
@@ -393,10 +422,11 @@ run (const std::string& filename,
 
   // Update all diagnostics, we need to do this before applying the remapper
   // to make sure that the remapped fields are the most up to date.
-  // First we reset the diag computed map so that all diags are recomputed.
+  // First we reset the diag computed map so that all diags are recomputed,
+  // unless another stream sharing the diag already computed it at this time.
   m_diag_computed.clear();
   for (auto& it : m_diagnostics) {
-    compute_diagnostic(it.first,allow_invalid_fields);
+    compute_diagnostic(it.first,timestamp,allow_invalid_fields);
   }
 
   auto apply_remap = [&](const std::shared_ptr<AbstractRemapper> remapper)
@@ -630,6 +660,12 @@ run (const std::string& filename,
           });
         }
       }
+      if (m_deferred_write) {
+        // Enqueue the copy to the snapshot buffer, and write it later
+        Kokkos::deep_copy (KT::ExeSpace(),m_snapshot_views_1d.at(name),view_dev);
+        m_pending_writes.push_back(name);
+        continue;
+      }
       // Bring data to host
       auto view_host = m_host_views_1d.at(name);
       Kokkos::deep_copy (view_host,view_dev);
@@ -644,6 +680,11 @@ run (const std::string& filename,
   if (is_write_step) {
     for (const auto& name : m_avg_cnt_names) {
       auto& view_dev = m_dev_views_1d.at(name);
+      if (m_deferred_write) {
+        Kokkos::deep_copy (KT::ExeSpace(),m_snapshot_views_1d.at(name),view_dev);
+        m_pending_writes.push_back(name);
+        continue;
+      }
       // Bring data to host
       auto view_host = m_host_views_1d.at(name);
       Kokkos::deep_copy (view_host,view_dev);
@@ -654,13 +695,71 @@ run (const std::string& filename,
       duration_write += duration_loc.count();
     }
   }
-  if (is_write_step) {
+  if (is_write_step and m_deferred_write) {
+    // A single fence for all the snapshot copies
+    Kokkos::fence();
+    m_pending_filename = filename;
+    if (m_atm_logger) {
+      m_atm_logger->info("  Done! Pending writes: " + std::to_string(m_pending_writes.size()));
+    }
+  } else if (is_write_step) {
     if (m_atm_logger) {
       m_atm_logger->info("  Done! Elapsed time: " + std::to_string(duration_write/1000.0) +" seconds");
     }
   }
 } // run
 
+void AtmosphereOutput::
+set_deferred_write (const bool deferred)
+{
+  EKAT_REQUIRE_MSG (not has_pending_writes(),
+      "Error! Cannot change deferred-write mode while writes are pending.\n");
+
+  m_deferred_write = deferred;
+  m_snapshot_views_1d.clear();
+  if (not deferred) {
+    return;
+  }
+
+  // If the host view aliases the field's host view, we need our own buffer,
+  // since the field host view may be changed (e.g., by a sync_to_host) before
+  // the pending writes are done.
+  for (const auto& it : m_host_views_1d) {
+    const auto& name = it.first;
+    const bool is_field = ekat::contains(m_fields_names,name);
+    if (is_field and aliases_field_view(name)) {
+      m_snapshot_views_1d.emplace(name,view_1d_host("",it.second.size()));
+    } else {
+      m_snapshot_views_1d.emplace(name,it.second);
+    }
+  }
+}
+
+int AtmosphereOutput::
+write_pending (const int max_vars)
+{
+  int nwritten = 0;
+  while (has_pending_writes() and (max_vars<=0 or nwritten<max_vars)) {
+    const auto& name = m_pending_writes.front();
+    scorpio::write_var(m_pending_filename,name,m_snapshot_views_1d.at(name).data());
+    m_pending_writes.pop_front();
+    ++nwritten;
+  }
+  return nwritten;
+}
+
+bool AtmosphereOutput::
+aliases_field_view (const std::string& name) const
+{
+  // Must match the logic in register_views
+  const bool is_diagnostic = (m_diagnostics.find(name) != m_diagnostics.end());
+  const auto field = get_field(name,"io");
+  return m_avg_type==OutputAvgType::Instant &&
+         field.get_header().get_alloc_properties().get_padding()==0 &&
+         field.get_header().get_parent().expired() &&
+         not is_diagnostic;
+}
+
 long long AtmosphereOutput::
 res_dep_memory_footprint () const {
   long long rdmf = 0;
@@ -743,6 +842,71 @@ AtmosphereOutput::get_field_manager (const std::string& mode) const
 
 /* ---------------------------------------------------------- */
 
+auto AtmosphereOutput::
+create_station_remapper (const ekat::ParameterList& stations_pl,
+                         const std::shared_ptr<const AbstractGrid>& grid) const
+ -> std::shared_ptr<remapper_type>
+{
+  using gid_type = AbstractGrid::gid_type;
+
+  // Get the stations coordinates, either from file or directly from the parameter list.
+  // We also build a name for the remap data, so that streams with the same stations
+  // *on the same grid* share it. The remap data stores the grid col lids, so the key
+  // must include the grid, and the coordinates must be printed at full precision.
+  std::vector<Real> lat, lon;
+  std::ostringstream data_name;
+  data_name << "stations:" << grid->name() << ":" << grid->get_num_global_dofs() << ":";
+  if (stations_pl.isParameter("file")) {
+    const auto& filename = stations_pl.get<std::string>("file");
+    scorpio::register_file(filename,scorpio::FileMode::Read);
+    const int nstations = scorpio::get_dimlen(filename,"ncol");
+    lat.resize(nstations);
+    lon.resize(nstations);
+    scorpio::read_var(filename,"lat",lat.data());
+    scorpio::read_var(filename,"lon",lon.data());
+    scorpio::release_file(filename);
+    data_name << filename;
+  } else {
+    EKAT_REQUIRE_MSG (stations_pl.isParameter("lat") and stations_pl.isParameter("lon"),
+        "Error! The 'stations' sublist must contain either 'file' or both 'lat' and 'lon'.\n");
+    const auto& lat_d = stations_pl.get<std::vector<double>>("lat");
+    const auto& lon_d = stations_pl.get<std::vector<double>>("lon");
+    EKAT_REQUIRE_MSG (lat_d.size()==lon_d.size(),
+        "Error! Stations 'lat' and 'lon' lists have different sizes.\n"
+        "  - lat size: " + std::to_string(lat_d.size()) + "\n"
+        "  - lon size: " + std::to_string(lon_d.size()) + "\n");
+    lat.assign(lat_d.begin(),lat_d.end());
+    lon.assign(lon_d.begin(),lon_d.end());
+    data_name << std::setprecision(std::numeric_limits<double>::max_digits10);
+    for (size_t i=0; i<lat_d.size(); ++i) {
+      data_name << "(" << lat_d[i] << "," << lon_d[i] << ")";
+    }
+  }
+  EKAT_REQUIRE_MSG (lat.size()>0,
+      "Error! The 'stations' sublist does not contain any station.\n");
+
+  // Find the column closest to each station. Only the owner of that column adds
+  // the corresponding entry in the sampling matrix, so that the stream only
+  // communicates the stations columns, rather than whole fields.
+  std::vector<int> pids, lids;
+  find_closest_columns(*grid,lat,lon,pids,lids);
+
+  const auto gids_h = grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  std::vector<gid_type> rows, cols;
+  std::vector<Real> S;
+  for (size_t i=0; i<lat.size(); ++i) {
+    if (pids[i]==m_comm.rank()) {
+      rows.push_back(i);
+      cols.push_back(gids_h(lids[i]));
+      S.push_back(1);
+    }
+  }
+
+  return std::make_shared<CoarseningRemapper>(grid,data_name.str(),rows,cols,S,true);
+}
+
+/* ---------------------------------------------------------- */
+
 void AtmosphereOutput::
 set_grid (const std::shared_ptr<const AbstractGrid>& grid)
 {
@@ -1243,7 +1407,8 @@ setup_output_file(const std::string& filename,
 // This routine will evaluate the diagnostics stored in this
 // output instance.
 void AtmosphereOutput::
-compute_diagnostic(const std::string& name, const bool allow_invalid_fields)
+compute_diagnostic(const std::string& name, const util::TimeStamp& timestamp,
+                   const bool allow_invalid_fields)
 {
   auto skip_diag = m_diag_computed[name];
   if (skip_diag) {
@@ -1251,11 +1416,16 @@ compute_diagnostic(const std::string& name, const bool allow_invalid_fields)
     return;
   }
   const auto& diag = m_diagnostics.at(name);
+  if (m_diags_registry->is_computed(diag.get(),timestamp)) {
+    // Another stream already computed this diag (and its deps) at this time
+    m_diag_computed[name] = true;
+    return;
+  }
   // Check if the diagnostics has any dependencies, if so, evaluate
   // them as well.  Needed if a diagnostic relies on another
   // diagnostic.
   for (const auto& dep : m_diag_depends_on_diags.at(name)) {
-    compute_diagnostic(dep,allow_invalid_fields);
+    compute_diagnostic(dep,timestamp,allow_invalid_fields);
   }
 
   m_diag_computed[name] = true;
@@ -1275,11 +1445,14 @@ compute_diagnostic(const std::string& name, const bool allow_invalid_fields)
 
   // The diag may have failed to compute (e.g., t=0 output with a flux-like diag).
   // If we're allowing invalid fields, then we should simply set diag=m_fill_value
-  if (allow_invalid_fields) {
-    auto d = diag->get_diagnostic();
-    if (not d.get_header().get_tracking().get_time_stamp().is_valid()) {
+  auto d = diag->get_diagnostic();
+  if (not d.get_header().get_tracking().get_time_stamp().is_valid()) {
+    if (allow_invalid_fields) {
       d.deep_copy(m_fill_value);
     }
+  } else {
+    // Only share results that were actually computed (not filled)
+    m_diags_registry->set_computed(diag.get(),timestamp);
   }
 }
 /* ---------------------------------------------------------- */
@@ -1449,15 +1622,24 @@ AtmosphereOutput::create_diagnostic (const std::string& diag_field_name) {
     params.set<std::string>("diag_name", diag_name);
   }
 
-  // Create the diagnostic
-  auto diag = diag_factory.create(diag_name,m_comm,params);
-  diag->set_grids(m_grids_manager);
+  // Create the diagnostic, unless another stream using the same registry
+  // already created an identical one, in which case we share it.
+  const auto sim_field_mgr = get_field_manager("sim");
+  const auto key = DiagnosticsRegistry::make_key(sim_field_mgr->get_grid()->name(),
+                                                 diag_field_name,m_fill_value);
+  const bool shared = m_diags_registry->has_diagnostic(key);
+  std::shared_ptr<AtmosphereDiagnostic> diag;
+  if (shared) {
+    diag = m_diags_registry->get_diagnostic(key);
+  } else {
+    diag = diag_factory.create(diag_name,m_comm,params);
+    diag->set_grids(m_grids_manager);
+  }
 
   // Ensure there's an entry in the map for this diag, so .at(diag_name) always works
   auto& deps = m_diag_depends_on_diags[diag->name()];
 
   // Initialize the diagnostic
-  const auto sim_field_mgr = get_field_manager("sim");
   for (const auto& freq : diag->get_required_field_requests()) {
     const auto& fname = freq.fid.name();
     if (!sim_field_mgr->has_field(fname)) {
@@ -1468,9 +1650,14 @@ AtmosphereOutput::create_diagnostic (const std::string& diag_field_name) {
       auto dep = m_diagnostics.at(fname);
       deps.push_back(fname);
     }
-    diag->set_required_field (get_field(fname,"sim"));
+    if (not shared) {
+      diag->set_required_field (get_field(fname,"sim"));
+    }
+  }
+  if (not shared) {
+    diag->initialize(util::TimeStamp(),RunType::Initial);
+    m_diags_registry->add_diagnostic(key,diag);
   }
-  diag->initialize(util::TimeStamp(),RunType::Initial);
   // If specified, set avg_cnt tracking for this diagnostic.
   if (m_track_avg_cnt) {
     const auto diag_field = diag->get_diagnostic();
@@ -3,6 +3,7 @@
 
 #include "share/io/scream_scorpio_interface.hpp"
 #include "share/io/scream_io_utils.hpp"
+#include "share/io/scream_diagnostics_registry.hpp"
 #include "share/field/field_manager.hpp"
 #include "share/grid/abstract_grid.hpp"
 #include "share/grid/grids_manager.hpp"
@@ -11,6 +12,8 @@
 
 #include "ekat/ekat_parameter_list.hpp"
 #include "ekat/mpi/ekat_comm.hpp"
+
+#include <list>
 /*  The AtmosphereOutput class handles an output stream in SCREAM.
  *  Typical usage is to register an AtmosphereOutput object with the OutputManager (see scream_output_manager.hpp
  *
@@ -62,6 +65,8 @@
  *                        SEGrid fields to PointGrid fields on the fly, to save on output size)
  *  - Max Snapshots Per File: the maximum number of snapshots saved per file. After this many
  *    snapshots, the current files is closed and a new file created.
+ *  - async_flush_vars_per_step: if positive, at output steps the fields are only copied to
+ *    host buffers, and written to file during the following steps, this many vars per step.
  *  - Output: parameters for output control
  *    - Frequency: the frequency of output writes (in the units specified by ${Output frequency_units})
  *    - frequency_units: the units of output frequency (nsteps, nmonths, nyears, nhours, ndays,...)
@@ -124,9 +129,12 @@ public:
   virtual ~AtmosphereOutput () = default;
 
   // Constructor
+  // If a diagnostics registry is passed, diagnostics are retrieved from (or added to)
+  // it, so that they can be shared with other streams using the same registry.
   AtmosphereOutput(const ekat::Comm& comm, const ekat::ParameterList& params,
                    const std::shared_ptr<const fm_type>& field_mgr,
-                   const std::shared_ptr<const gm_type>& grids_mgr);
+                   const std::shared_ptr<const gm_type>& grids_mgr,
+                   const std::shared_ptr<DiagnosticsRegistry>& diags_registry = nullptr);
 
   // Short version for outputing a list of fields (no remapping supported)
   AtmosphereOutput(const ekat::Comm& comm,
@@ -144,10 +152,22 @@ public:
   void run (const std::string& filename,
             const bool output_step, const bool checkpoint_step,
             const int nsteps_since_last_output,
-            const bool allow_invalid_fields = false);
+            const bool allow_invalid_fields = false,
+            const util::TimeStamp& timestamp = util::TimeStamp());
 
   long long res_dep_memory_footprint () const;
 
+  // In deferred-write mode, a write step only copies the output data to host
+  // snapshot buffers (with one fence for all fields), and records the variables
+  // as pending. The actual scorpio writes happen later, via write_pending, so
+  // that the caller can spread them over the following time steps.
+  void set_deferred_write (const bool deferred);
+  bool has_pending_writes () const { return not m_pending_writes.empty(); }
+
+  // Write up to max_vars pending variables (all of them if max_vars<=0).
+  // Returns the number of variables written.
+  int write_pending (const int max_vars);
+
   std::shared_ptr<const AbstractGrid> get_io_grid () const {
     return m_io_grid;
   }
@@ -171,11 +191,18 @@ protected:
   std::vector<scorpio::offset_t> get_var_dof_offsets (const FieldLayout& layout);
   void register_views();
   Field get_field(const std::string& name, const std::string& mode) const;
-  void compute_diagnostic (const std::string& name, const bool allow_invalid_fields = false);
+  bool aliases_field_view (const std::string& name) const;
+  void compute_diagnostic (const std::string& name, const util::TimeStamp& timestamp,
+                           const bool allow_invalid_fields = false);
   void set_diagnostics();
   std::shared_ptr<AtmosphereDiagnostic>
   create_diagnostic (const std::string& diag_name);
 
+  // Create a remapper that samples fields at the columns closest to the given stations
+  std::shared_ptr<remapper_type>
+  create_station_remapper (const ekat::ParameterList& stations_pl,
+                           const std::shared_ptr<const AbstractGrid>& grid) const;
+
   // Tracking the averaging of any filled values:
   void set_avg_cnt_tracking(const std::string& name, const FieldLayout& layout);
 
@@ -206,6 +233,7 @@ protected:
   std::map<std::string,std::shared_ptr<atm_diag_type>>  m_diagnostics;
   std::map<std::string,std::vector<std::string>>        m_diag_depends_on_diags;
   std::map<std::string,bool>                            m_diag_computed;
+  std::shared_ptr<DiagnosticsRegistry>                  m_diags_registry;
   LongNames                                             m_longnames;
 
   // Use float, so that if output fp_precision=float, this is a representable value.
@@ -219,6 +247,15 @@ protected:
   std::map<std::string,view_1d_host>    m_host_views_1d;
   std::map<std::string,view_1d_dev>     m_dev_views_1d;
 
+  // Deferred-write mode: host copies of the output data at the last write step,
+  // and the variables that still need to be written to m_pending_filename.
+  // NOTE: snapshot views are separate allocations only for fields whose host
+  //       view aliases the field's own host view; otherwise they are m_host_views_1d.
+  bool                                  m_deferred_write = false;
+  std::map<std::string,view_1d_host>    m_snapshot_views_1d;
+  std::list<std::string>                m_pending_writes;
+  std::string                           m_pending_filename;
+
   bool m_add_time_dim;
   bool m_track_avg_cnt = false;
 
@@ -3,6 +3,7 @@
 
 #include "share/io/scream_scorpio_interface.hpp"
 #include "share/grid/point_grid.hpp"
+#include "share/grid/spherical_spatial_index.hpp"
 
 #include <ekat/util/ekat_string_utils.hpp>
 
@@ -75,8 +76,6 @@ void SCMInput::create_io_grid ()
 void SCMInput::create_closest_col_info (double target_lat, double target_lon)
 {
   // Read lat/lon fields
-  const auto ncols = m_io_grid->get_num_local_dofs();
-
   auto nondim = ekat::units::Units::nondimensional();
   auto lat = m_io_grid->create_geometry_data("lat",m_io_grid->get_2d_scalar_layout(),nondim);
   auto lon = m_io_grid->create_geometry_data("lon",m_io_grid->get_2d_scalar_layout(),nondim);
@@ -86,28 +85,13 @@ void SCMInput::create_closest_col_info (double target_lat, double target_lon)
   file_reader.read_variables();
   file_reader.finalize();
 
-  // Find column index of closest lat/lon to target_lat/lon params
-  auto lat_d = lat.get_view<Real*>();
-  auto lon_d = lon.get_view<Real*>();
-  using minloc_t = Kokkos::MinLoc<Real,int>;
-  using minloc_value_t = typename minloc_t::value_type;
-  minloc_value_t minloc;
-  Kokkos::parallel_reduce(ncols, KOKKOS_LAMBDA (int icol, minloc_value_t& result) {
-    auto dist = std::abs(lat_d(icol)-target_lat)+std::abs(lon_d(icol)-target_lon);
-    if(dist<result.val) {
-      result.val = dist;
-      result.loc = icol;
-    }
-  }, minloc_t(minloc));
-
-  // Find processor with closest lat/lon match
-  const auto my_rank = m_comm.rank();
-  std::pair<Real, int> min_dist_and_rank = {minloc.val, my_rank};
-  m_comm.all_reduce<std::pair<Real, int>>(&min_dist_and_rank, 1, MPI_MINLOC);
-
-  // Set local col idx to -1 for mpi ranks not containing minimum lat/lon distance
-  m_closest_col_info.mpi_rank = min_dist_and_rank.second;
-  m_closest_col_info.col_lid  = my_rank==min_dist_and_rank.second ? minloc.loc : -1;
+  // Find rank and column index of closest lat/lon to target_lat/lon params,
+  // using the spatial index of the io grid.
+  // Note: local col idx is -1 for mpi ranks not containing the closest column
+  std::vector<int> pids, lids;
+  find_closest_columns(*m_io_grid,{target_lat},{target_lon},pids,lids);
+  m_closest_col_info.mpi_rank = pids[0];
+  m_closest_col_info.col_lid  = lids[0];
 }
 
 void SCMInput::read_variables (const int time_index)
@@ -0,0 +1,111 @@
+#ifndef SCREAM_DIAGNOSTICS_REGISTRY_HPP
+#define SCREAM_DIAGNOSTICS_REGISTRY_HPP
+
+#include "share/atm_process/atmosphere_diagnostic.hpp"
+#include "share/util/scream_time_stamp.hpp"
+
+#include <ekat/ekat_assert.hpp>
+
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+
+namespace scream
+{
+
+/*
+ * A small registry of output diagnostics, which can be shared by several
+ * output streams (and several OutputManager's).
+ *
+ * When multiple streams request the same diagnostic (e.g., RelativeHumidity
+ * on the physics grid), they will all get the same AtmosphereDiagnostic
+ * instance from the registry. The registry also keeps track of the last
+ * time each diagnostic was computed (and had init_timestep called), so that
+ * the streams can skip the work if another stream already did it at the
+ * same time stamp.
+ *
+ * Diagnostics are identified by a key built from the name of the grid where
+ * the diag is computed, the output name of the diag, and the fill value used
+ * by the stream (which some diags use as mask value).
+ */
+
+class DiagnosticsRegistry
+{
+public:
+  using diag_type     = AtmosphereDiagnostic;
+  using diag_ptr_type = std::shared_ptr<diag_type>;
+
+  static std::string make_key (const std::string& grid_name,
+                               const std::string& diag_field_name,
+                               const double fill_value)
+  {
+    std::ostringstream ss;
+    ss.precision(17);
+    ss << grid_name << "::" << diag_field_name << "::" << fill_value;
+    return ss.str();
+  }
+
+  bool has_diagnostic (const std::string& key) const {
+    return m_diags.count(key)==1;
+  }
+
+  diag_ptr_type get_diagnostic (const std::string& key) const {
+    EKAT_REQUIRE_MSG (has_diagnostic(key),
+        "Error! Diagnostic '" + key + "' not found in the diagnostics registry.\n");
+    return m_diags.at(key);
+  }
+
+  void add_diagnostic (const std::string& key, const diag_ptr_type& diag) {
+    EKAT_REQUIRE_MSG (not has_diagnostic(key),
+        "Error! Diagnostic '" + key + "' was already added to the diagnostics registry.\n");
+    m_diags[key] = diag;
+  }
+
+  int num_diagnostics () const { return m_diags.size(); }
+
+  // Returns true if init_timestep has to be called on this diag for this step,
+  // and records that it was. An invalid time stamp always returns true.
+  bool needs_init_timestep (const diag_type* diag, const util::TimeStamp& start_of_step) {
+    return needs_update(m_last_init,diag,start_of_step);
+  }
+
+  // Returns true if this diag was already computed at this time stamp.
+  bool is_computed (const diag_type* diag, const util::TimeStamp& ts) const {
+    if (not ts.is_valid()) {
+      return false;
+    }
+    auto it = m_last_compute.find(diag);
+    return it!=m_last_compute.end() and it->second==ts;
+  }
+
+  void set_computed (const diag_type* diag, const util::TimeStamp& ts) {
+    if (ts.is_valid()) {
+      m_last_compute[diag] = ts;
+    }
+  }
+
+protected:
+
+  bool needs_update (std::map<const diag_type*,util::TimeStamp>& last,
+                     const diag_type* diag, const util::TimeStamp& ts)
+  {
+    if (not ts.is_valid()) {
+      return true;
+    }
+    auto it = last.find(diag);
+    if (it!=last.end() and it->second==ts) {
+      return false;
+    }
+    last[diag] = ts;
+    return true;
+  }
+
+  std::map<std::string,diag_ptr_type>         m_diags;
+  std::map<const diag_type*,util::TimeStamp>  m_last_init;
+  std::map<const diag_type*,util::TimeStamp>  m_last_compute;
+};
+
+} // namespace scream
+
+#endif // SCREAM_DIAGNOSTICS_REGISTRY_HPP
@@ -13,6 +13,7 @@
 #include <memory>
 #include <chrono>
 #include <ctime>
+#include <cstdio>
 
 namespace scream
 {
@@ -71,10 +72,17 @@ setup (const std::map<std::string,std::shared_ptr<fm_type>>& field_mgrs,
     if (*it == "Physics PG2") pg2_grid_in_io_streams = true;
   }
 
+  // Diagnostics are shared among streams with the same registry. If none was
+  // provided, at least share them among the streams of this manager.
+  if (not m_diags_registry) {
+    m_diags_registry = std::make_shared<DiagnosticsRegistry>();
+  }
+
   // For each grid, create a separate output stream.
   if (field_mgrs.size()==1) {
-    auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.begin()->second,grids_mgr);
+    auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.begin()->second,grids_mgr,m_diags_registry);
     output->set_logger(m_atm_logger);
+    output->set_deferred_write(m_async_vars_per_step>0);
     m_output_streams.push_back(output);
   } else {
     for (auto it=fields_pl.sublists_names_cbegin(); it!=fields_pl.sublists_names_cend(); ++it) {
@@ -106,8 +114,9 @@ setup (const std::map<std::string,std::shared_ptr<fm_type>>& field_mgrs,
       EKAT_REQUIRE_MSG (field_mgrs.find(gname)!=field_mgrs.end(),
           "Error! Output requested on grid '" + gname + "', but no field manager is available for such grid.\n");
 
-      auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.at(gname),grids_mgr);
+      auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.at(gname),grids_mgr,m_diags_registry);
       output->set_logger(m_atm_logger);
+      output->set_deferred_write(m_async_vars_per_step>0);
       m_output_streams.push_back(output);
     }
   }
@@ -370,6 +379,19 @@ void OutputManager::run(const util::TimeStamp& timestamp)
   const bool is_full_checkpoint_step = is_checkpoint_step && has_checkpoint_data && not is_output_step;
   const bool is_write_step           = is_output_step || is_checkpoint_step;
 
+  // In async mode, output files are written over the next steps. However, at checkpoint steps,
+  // we write everything right away, so that the rhist file is consistent with the output file.
+  const bool defer_writes = m_async_vars_per_step>0 && is_output_step && not is_checkpoint_step;
+
+  // Continue writing the output file from a previous step (if any). If we need
+  // to write a new file, complete the pending one first, since streams will
+  // overwrite their snapshot buffers.
+  if (m_has_pending_file) {
+    start_timer(timer_root+"::flush_pending_writes");
+    flush_pending_writes(is_write_step ? 0 : m_async_vars_per_step);
+    stop_timer(timer_root+"::flush_pending_writes");
+  }
+
   // Update counters
   ++m_output_control.nsamples_since_last_write;
   if (not is_t0_output) {
@@ -412,13 +434,13 @@ void OutputManager::run(const util::TimeStamp& timestamp)
     if (m_io_comm.am_i_root() and filespecs.is_restart_file()) {
       std::ofstream rpointer;
       if (m_is_model_restart_output) {
-        rpointer.open("rpointer.atm");  // Open rpointer and nuke its content
+        rpointer.open(m_rpointer_filename);  // Open rpointer and nuke its content
       } else if (is_checkpoint_step) {
         // Output restart unit tests do not have a model-output stream that generates rpointer.atm,
         // so allow to skip the next check for them.
         auto is_unit_testing = m_params.sublist("Checkpoint Control").get("is_unit_testing",false);
-        EKAT_REQUIRE_MSG (is_unit_testing || std::ifstream("rpointer.atm").good(),
-            "Error! Cannot find rpointer.atm file to append history restart file in.\n"
+        EKAT_REQUIRE_MSG (is_unit_testing || std::ifstream(m_rpointer_filename).good(),
+            "Error! Cannot find " + m_rpointer_filename + " file to append history restart file in.\n"
             " Model restart output is supposed to be in charge of creating rpointer.atm.\n"
             " There are two possible causes:\n"
             "   1. You have a 'Checkpoint Control' list in your output stream, but no Scorpio::model_restart\n"
@@ -426,7 +448,7 @@ void OutputManager::run(const util::TimeStamp& timestamp)
             "   2. The current implementation assumes that the model restart OutputManager runs\n"
             "      *before* any other output stream (so it can nuke rpointer.atm if already existing).\n"
             "      If this has changed, we need to revisit this piece of the code.\n");
-        rpointer.open("rpointer.atm",std::ofstream::app);  // Open rpointer file and append to it
+        rpointer.open(m_rpointer_filename,std::ofstream::app);  // Open rpointer file and append to it
       }
       rpointer << filespecs.filename << std::endl;
     }
@@ -461,7 +483,11 @@ void OutputManager::run(const util::TimeStamp& timestamp)
     if (m_atm_logger) {
       m_atm_logger->debug("[OutputManager]: writing fields from grid " + it->get_io_grid()->name() + "...\n");
     }
-    it->run(fields_write_filename,is_output_step,is_full_checkpoint_step,m_output_control.nsamples_since_last_write,is_t0_output);
+    it->run(fields_write_filename,is_output_step,is_full_checkpoint_step,m_output_control.nsamples_since_last_write,is_t0_output,timestamp);
+
+    if (not defer_writes) {
+      it->write_pending(0);
+    }
   }
   stop_timer(timer_root+"::run_output_streams");
 
@@ -544,7 +570,13 @@ void OutputManager::run(const util::TimeStamp& timestamp)
         scorpio::write_var(filespecs.filename, "time_bnds", m_time_bnds.data());
       }
 
-      close_or_flush_if_needed(filespecs,control);
+      // In async mode, the streams have pending writes, so the output file stays open
+      // until flush_pending_writes completes it
+      if (defer_writes) {
+        m_has_pending_file = true;
+      } else {
+        close_or_flush_if_needed(filespecs,control);
+      }
     };
 
     start_timer(timer_root+"::update_snapshot_tally");
@@ -574,6 +606,11 @@ void OutputManager::run(const util::TimeStamp& timestamp)
 /*===============================================================================================*/
 void OutputManager::finalize()
 {
+  // Complete any async restart file
+  if (m_has_pending_file) {
+    flush_pending_writes(0);
+  }
+
   // Close any output file still open
   if (m_output_file_specs.is_open) {
     scorpio::release_file (m_output_file_specs.filename);
@@ -588,6 +625,7 @@ void OutputManager::finalize()
   //       which in turns calls finalize, causing endless recursion.
   m_output_streams = {};
   m_geo_data_streams = {};
+  m_diags_registry = nullptr;
   m_globals.clear();
   m_io_comm = {};
   m_params  = {};
@@ -601,6 +639,39 @@ void OutputManager::finalize()
   m_case_t0 = {};
   m_run_t0 = {};
   m_atm_logger = {};
+  m_async_vars_per_step = 0;
+  m_rpointer_filename = "rpointer.atm";
+}
+
+void OutputManager::
+flush_pending_writes (const int max_vars)
+{
+  int budget = max_vars;
+  for (auto& s : m_output_streams) {
+    if (max_vars>0 and budget<=0) {
+      break;
+    }
+    budget -= s->write_pending(max_vars>0 ? budget : 0);
+  }
+
+  for (const auto& s : m_output_streams) {
+    if (s->has_pending_writes()) {
+      return;
+    }
+  }
+
+  // All vars are in the file: we can close/flush it, and, for model restart, make rpointer.atm point to it
+  close_or_flush_if_needed(m_output_file_specs,m_output_control);
+  if (m_io_comm.am_i_root() and m_is_model_restart_output and m_rpointer_filename!="rpointer.atm") {
+    const int err = std::rename(m_rpointer_filename.c_str(),"rpointer.atm");
+    EKAT_REQUIRE_MSG (err==0,
+        "Error! Could not rename " + m_rpointer_filename + " to rpointer.atm.\n");
+  }
+  m_has_pending_file = false;
+
+  if (m_atm_logger) {
+    m_atm_logger->info("[EAMxx::output_manager] - Completed async write of " + m_output_file_specs.filename);
+  }
 }
 
 long long OutputManager::res_dep_memory_footprint () const {
@@ -717,6 +788,14 @@ setup_internals (const std::map<std::string,std::shared_ptr<fm_type>>& field_mgr
         "  - supported values: float, single, double, real\n");
   }
 
+  // Optionally, snapshot output fields to host at the output step, and write
+  // them to file over the following steps, at most this many vars per step.
+  // Checkpoint (rhist) files are always written synchronously.
+  m_async_vars_per_step = m_params.get<int>("async_flush_vars_per_step",0);
+  if (m_is_model_restart_output and m_async_vars_per_step>0) {
+    m_rpointer_filename = "rpointer.atm.pending";
+  }
+
   // Output control
   EKAT_REQUIRE_MSG(m_params.isSublist("output_control"),
       "Error! The output control YAML file for " + m_filename_prefix + " is missing the sublist 'output_control'");
@@ -747,6 +826,8 @@ setup_internals (const std::map<std::string,std::shared_ptr<fm_type>>& field_mgr
 
   if (m_params.isSublist("Checkpoint Control")) {
     auto& pl = m_params.sublist("Checkpoint Control");
+    // If the model restart is written asynchronously, the AD tells us which rpointer file to append to
+    m_rpointer_filename = pl.get<std::string>("rpointer_filename",m_rpointer_filename);
     m_checkpoint_control.set_frequency_units(pl.get<std::string>("frequency_units"));
 
     if (m_checkpoint_control.output_enabled()) {
@@ -6,6 +6,7 @@
 #include "share/io/scream_io_utils.hpp"
 #include "share/io/scream_io_file_specs.hpp"
 #include "share/io/scream_io_control.hpp"
+#include "share/io/scream_diagnostics_registry.hpp"
 
 #include "share/field/field_manager.hpp"
 #include "share/grid/grids_manager.hpp"
@@ -112,10 +113,23 @@ public:
   }
   void add_global (const std::string& name, const ekat::any& global);
 
+  // Share diagnostics with other OutputManager's using the same registry.
+  // Must be called before setup, otherwise a private registry is used.
+  void set_diagnostics_registry (const std::shared_ptr<DiagnosticsRegistry>& registry) {
+    m_diags_registry = registry;
+  }
+
   void init_timestep (const util::TimeStamp& start_of_step, const Real dt);
   void run (const util::TimeStamp& current_ts);
   void finalize();
 
+  // In async mode, the output fields are snapshotted to host buffers at the
+  // output step, and written to file over the following steps. This writes up
+  // to max_vars pending vars (all if max_vars<=0), and, once all vars are written,
+  // closes/flushes the file (and, for model restart, updates rpointer.atm).
+  void flush_pending_writes (const int max_vars);
+  bool has_pending_writes () const { return m_has_pending_file; }
+
   long long res_dep_memory_footprint () const;
 
   bool is_restart () const { return m_is_model_restart_output; }
@@ -192,6 +206,17 @@ protected:
   // The logger to be used throughout the ATM to log message
   std::shared_ptr<ekat::logger::LoggerBase> m_atm_logger;
 
+  // Diagnostics are created (and computed) at most once across all streams using this registry
+  std::shared_ptr<DiagnosticsRegistry> m_diags_registry;
+
+  // Async (deferred) output writes. If m_async_vars_per_step>0, output files are
+  // written at most m_async_vars_per_step vars per step. For model restart, until
+  // the file is complete, the rpointer entries for this checkpoint go in a pending
+  // file, which is renamed to rpointer.atm at completion.
+  int         m_async_vars_per_step = 0;
+  bool        m_has_pending_file = false;
+  std::string m_rpointer_filename = "rpointer.atm";
+
   // If true, we save grid data in output file
   bool m_save_grid_data;
 };
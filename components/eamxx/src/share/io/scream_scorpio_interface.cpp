@@ -1168,8 +1168,8 @@ std::vector<double> get_all_times (const std::string& filename)
   const auto& dim = *pf.file->time_dim;
 
   std::vector<double> times (dim.length);
-  for (int i=0; i<dim.length; ++i) {
-    read_var (filename, dim.name, &times[i], i);
+  if (dim.length>0) {
+    read_all_records (filename, dim.name, times.data());
   }
   return times;
 }
@@ -1271,6 +1271,61 @@ void read_var (const std::string &filename, const std::string &varname, T* buf,
   check_scorpio_noerr (err,f.name,"variable",varname,"read_var",pioc_func);
 }
 
+template<typename T>
+void read_all_records (const std::string &filename, const std::string &varname, T* buf)
+{
+  EKAT_REQUIRE_MSG (buf!=nullptr,
+      "Error! Cannot read from provided pointer. Invalid buffer pointer.\n"
+      " - filename: " + filename + "\n"
+      " - varname : " + varname + "\n");
+
+  const auto& f = impl::get_file(filename,"scorpio::read_all_records");
+        auto& var = impl::get_var(filename,varname,"scorpio::read_all_records");
+
+  EKAT_REQUIRE_MSG (var.decomp==nullptr,
+      "Error! Cannot read all records of a decomposed variable.\n"
+      " - filename: " + filename + "\n"
+      " - varname : " + varname + "\n");
+
+  if (not var.time_dep) {
+    // Nothing special to do: a single get_var call reads the whole thing
+    read_var(filename,varname,buf);
+    return;
+  }
+
+  // If the input pointer type already matches var.dtype, this is a no-op
+  change_var_dtype(var,get_dtype<T>(),filename);
+
+  const int nrecords = f.time_dim->length;
+  int ndims = var.dims.size();
+  std::vector<PIO_Offset> start (ndims+1,0), count(ndims+1); // +1 for time
+  count[0] = nrecords;
+  int size = nrecords;
+  for (int idim=0; idim<ndims; ++idim) {
+    count[idim+1] = var.dims[idim]->length;
+    size *= var.dims[idim]->length;
+  }
+
+  int err;
+  if (var.dtype==var.nc_dtype) {
+    err = PIOc_get_vara(f.ncid,var.ncid,start.data(),count.data(),buf);
+  } else {
+    // The var internal buffer only holds one record, so use a tmp one
+    std::vector<char> io_buf (size*dtype_size(var.nc_dtype));
+    err = PIOc_get_vara(f.ncid,var.ncid,start.data(),count.data(),io_buf.data());
+    if (var.nc_dtype=="int") {
+      copy_data(reinterpret_cast<int*>(io_buf.data()),buf,size);
+    } else if (var.nc_dtype=="int64") {
+      copy_data(reinterpret_cast<long long*>(io_buf.data()),buf,size);
+    } else if (var.nc_dtype=="float") {
+      copy_data(reinterpret_cast<float*>(io_buf.data()),buf,size);
+    } else if (var.nc_dtype=="double") {
+      copy_data(reinterpret_cast<double*>(io_buf.data()),buf,size);
+    }
+  }
+  check_scorpio_noerr (err,f.name,"variable",varname,"read_all_records","get_vara");
+}
+
 // Write data from user provided buffer into the requested variable
 template<typename T>
 void write_var (const std::string &filename, const std::string &varname, const T* buf, const T* fillValue)
@@ -1358,6 +1413,11 @@ template void read_var<float>     (const std::string&, const std::string&, float
 template void read_var<double>    (const std::string&, const std::string&, double*,    const int);
 template void read_var<char>      (const std::string&, const std::string&, char*,      const int);
 
+template void read_all_records<int>       (const std::string&, const std::string&, int*);
+template void read_all_records<long long> (const std::string&, const std::string&, long long*);
+template void read_all_records<float>     (const std::string&, const std::string&, float*);
+template void read_all_records<double>    (const std::string&, const std::string&, double*);
+
 template void write_var<int>       (const std::string&, const std::string&, const int*,       const int*);
 template void write_var<long long> (const std::string&, const std::string&, const long long*, const long long*);
 template void write_var<float>     (const std::string&, const std::string&, const float*,     const float*);
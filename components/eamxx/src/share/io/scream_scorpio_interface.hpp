@@ -197,6 +197,15 @@ std::vector<double> get_all_times (const std::string& filename);
 template<typename T>
 void read_var (const std::string &filename, const std::string &varname, T* buf, const int time_index = -1);
 
+// Read all the records of a non-decomposed variable with a single call.
+// If the var is time dependent, buf must be able to hold time_len*var_size entries,
+// with the time index being the slowest striding one. Otherwise, this is the
+// same as read_var with time_index=-1. This is much cheaper than calling
+// read_var in a loop over the time indices, since each call is collective.
+// NOTE: ETI in the cpp file for int, float, double.
+template<typename T>
+void read_all_records (const std::string &filename, const std::string &varname, T* buf);
+
 // Write data from user provided buffer into the requested variable
 // NOTE: ETI in the cpp file for int, float, double.
 template<typename T>
@@ -126,7 +126,8 @@ get_fm (const std::shared_ptr<const AbstractGrid>& grid,
 
 // Returns fields after initialization
 void write (const std::string& avg_type, const std::string& freq_units,
-            const int freq, const int seed, const ekat::Comm& comm)
+            const int freq, const int seed, const ekat::Comm& comm,
+            const int async_vars_per_step = 0)
 {
   // Create grid
   auto gm = get_gm(comm);
@@ -161,6 +162,7 @@ void write (const std::string& avg_type, const std::string& freq_units,
     ++max_snaps;
   }
   om_pl.set("Max Snapshots Per File", max_snaps);
+  om_pl.set("async_flush_vars_per_step", async_vars_per_step);
 
   // Create Output manager
   OutputManager om;
@@ -189,6 +191,25 @@ void write (const std::string& avg_type, const std::string& freq_units,
 
     // Run output manager
     om.run (t);
+
+    // In async mode, an output step only snapshots the fields, and the file
+    // is written over the following steps (one var per step, for 3 vars)
+    if (async_vars_per_step>0 and (n+1)%freq==0) {
+      REQUIRE (om.has_pending_writes());
+    }
+  }
+
+  // In async mode, the last snapshot is still pending. Change the fields before
+  // completing the writes: the file must still contain the snapshotted values,
+  // which the read phase checks.
+  if (async_vars_per_step>0) {
+    REQUIRE (om.has_pending_writes());
+    for (const auto& name : fnames) {
+      auto f = fm->get_field(name);
+      add(f,1000.0);
+    }
+    om.flush_pending_writes(0);
+    REQUIRE (not om.has_pending_writes());
   }
 
   // Check that the file was closed, since we reached full capacity
@@ -321,6 +342,16 @@ TEST_CASE ("io_basic") {
       print(" PASS\n");
     }
   }
+
+  // Async output: fields are snapshotted at output steps, and written to file
+  // one var per step, while the fields keep changing.
+  print ("-> Async output, frequency: nsteps\n");
+  for (const auto& avg : avg_type) {
+    print("   -> Averaging type: " + avg + " ", 40);
+    write(avg,"nsteps",freq,seed,comm,1);
+    read (avg,"nsteps",freq,seed,comm);
+    print(" PASS\n");
+  }
   scorpio::finalize_subsystem();
 }
 
@@ -68,9 +68,16 @@ public:
     m_t_beg = start_of_step;
   }
 
+  // Count calls to compute, to check that streams sharing the diag compute it once
+  static int& num_computes () {
+    static int n = 0;
+    return n;
+  }
+
 protected:
 
   void compute_diagnostic_impl () override {
+    ++num_computes();
     const auto& f_in  = get_field_in(m_f_in);
 
     const auto& t = f_in.get_header().get_tracking().get_time_stamp();
@@ -194,11 +201,22 @@ void write (const int seed, const ekat::Comm& comm)
   ctrl_pl.set("Frequency",1);
   ctrl_pl.set("save_grid_data",false);
 
-  // Create Output manager
+  // Create Output manager. A second manager (writing to a different file)
+  // shares the diagnostics registry, so MyDiag is created/computed only once.
+  auto diags_registry = std::make_shared<DiagnosticsRegistry>();
   OutputManager om;
   om.initialize(comm, om_pl, t0, false);
+  om.set_diagnostics_registry(diags_registry);
   om.setup(fm,gm);
 
+  auto om2_pl = om_pl;
+  om2_pl.set("filename_prefix",std::string("io_diags_shared"));
+  OutputManager om2;
+  om2.initialize(comm, om2_pl, t0, false);
+  om2.set_diagnostics_registry(diags_registry);
+  om2.setup(fm,gm);
+  REQUIRE (diags_registry->num_diagnostics()==1);
+
   // Run output manager
   for (auto it : *fm) {
     auto& f = *it.second;
@@ -207,11 +225,16 @@ void write (const int seed, const ekat::Comm& comm)
     f.get_header().get_tracking().update_time_stamp(t0+dt);
     f.update(one,1.0,1.0);
   }
+  MyDiag::num_computes() = 0;
   om.init_timestep(t0,dt);
+  om2.init_timestep(t0,dt);
   om.run (t0+dt);
+  om2.run (t0+dt);
+  REQUIRE (MyDiag::num_computes()==1);
 
   // Close file and cleanup
   om.finalize();
+  om2.finalize();
 }
 
 void read (const int seed, const ekat::Comm& comm)
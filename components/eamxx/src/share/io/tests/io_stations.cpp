@@ -0,0 +1,208 @@
+#include <catch2/catch.hpp>
+
+#include "share/io/scream_output_manager.hpp"
+#include "share/io/scream_scorpio_interface.hpp"
+
+#include "share/grid/mesh_free_grids_manager.hpp"
+
+#include "share/field/field.hpp"
+#include "share/field/field_manager.hpp"
+
+#include "share/util/scream_time_stamp.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/ekat_parameter_list.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <memory>
+#include <map>
+
+namespace scream {
+
+constexpr int nlevs = 4;
+
+util::TimeStamp get_t0 () {
+  return util::TimeStamp({2023,2,17},{0,0,0});
+}
+
+// Columns are evenly spaced on the lon=0 meridian, between -80 and 80 degrees
+Real col_dlat (const int ngcols) {
+  return 160.0/(ngcols-1);
+}
+Real col_lat (const AbstractGrid::gid_type gid, const int ngcols) {
+  return -80 + gid*col_dlat(ngcols);
+}
+
+// The value of the test field at a given column and level
+Real f_val (const AbstractGrid::gid_type gid, const int ilev) {
+  return 100*gid + ilev;
+}
+
+std::shared_ptr<GridsManager>
+get_gm (const ekat::Comm& comm, const std::map<std::string,int>& grids_ngcols)
+{
+  ekat::ParameterList gm_params;
+  std::vector<std::string> grids_names;
+  for (const auto& it : grids_ngcols) {
+    grids_names.push_back(it.first);
+    auto& pl = gm_params.sublist(it.first);
+    pl.set("type",std::string("point_grid"));
+    pl.set("number_of_global_columns",it.second);
+    pl.set("number_of_vertical_levels",nlevs);
+  }
+  gm_params.set("grids_names",grids_names);
+  gm_params.set("geo_data_source",std::string("CREATE_EMPTY_DATA"));
+  auto gm = create_mesh_free_grids_manager(comm,gm_params);
+  gm->build_grids();
+
+  // Set lat/lon, so that stations can be located
+  using gid_type = AbstractGrid::gid_type;
+  for (const auto& it : grids_ngcols) {
+    auto grid = gm->get_grid_nonconst(it.first);
+    auto gids = grid->get_dofs_gids().get_view<const gid_type*,Host>();
+    auto lat = grid->get_geometry_data("lat");
+    auto lon = grid->get_geometry_data("lon");
+    auto lat_h = lat.get_view<Real*,Host>();
+    auto lon_h = lon.get_view<Real*,Host>();
+    for (int i=0; i<grid->get_num_local_dofs(); ++i) {
+      lat_h(i) = col_lat(gids(i),it.second);
+      lon_h(i) = 0;
+    }
+    lat.sync_to_dev();
+    lon.sync_to_dev();
+  }
+
+  return gm;
+}
+
+std::shared_ptr<FieldManager>
+get_fm (const std::shared_ptr<const AbstractGrid>& grid,
+        const util::TimeStamp& t0)
+{
+  using namespace ShortFieldTagsNames;
+  using gid_type = AbstractGrid::gid_type;
+
+  const int nlcols = grid->get_num_local_dofs();
+  auto gids = grid->get_dofs_gids().get_view<const gid_type*,Host>();
+
+  auto fm = std::make_shared<FieldManager>(grid);
+
+  FieldIdentifier fid("f",FieldLayout({COL,LEV},{nlcols,nlevs}),
+                      ekat::units::Units::nondimensional(),grid->name());
+  Field f(fid);
+  f.allocate_view();
+  auto f_h = f.get_view<Real**,Host>();
+  for (int icol=0; icol<nlcols; ++icol) {
+    for (int ilev=0; ilev<nlevs; ++ilev) {
+      f_h(icol,ilev) = f_val(gids(icol),ilev);
+    }
+  }
+  f.sync_to_dev();
+  f.get_header().get_tracking().update_time_stamp(t0);
+  fm->add_field(f);
+
+  return fm;
+}
+
+std::shared_ptr<OutputManager>
+create_om (const std::string& prefix,
+           const std::vector<double>& lat, const std::vector<double>& lon,
+           const std::shared_ptr<FieldManager>& fm,
+           const std::shared_ptr<GridsManager>& gm,
+           const util::TimeStamp& t0, const ekat::Comm& comm)
+{
+  ekat::ParameterList om_pl;
+  om_pl.set("filename_prefix",prefix);
+  om_pl.set("Field Names",std::vector<std::string>{"f"});
+  om_pl.set("Averaging Type",std::string("INSTANT"));
+  auto& stations_pl = om_pl.sublist("stations");
+  stations_pl.set("lat",lat);
+  stations_pl.set("lon",lon);
+  auto& ctrl_pl = om_pl.sublist("output_control");
+  ctrl_pl.set("frequency_units",std::string("nsteps"));
+  ctrl_pl.set("Frequency",1);
+  ctrl_pl.set("save_grid_data",false);
+
+  auto om = std::make_shared<OutputManager>();
+  om->initialize(comm,om_pl,t0,false);
+  om->setup(fm,gm);
+  return om;
+}
+
+// Write the same stations on two grids. Grid B has twice the resolution of
+// grid A, so a station close to A's column gid is closest to B's column 2*gid.
+// Both streams are alive at the same time, so that, if they were to share the
+// stations remap data, B would sample the columns picked for A.
+void write (const std::vector<int>& station_gids, const int ngcols_a, const int ngcols_b,
+            const ekat::Comm& comm)
+{
+  auto gm = get_gm(comm,{{"Point Grid A",ngcols_a},{"Point Grid B",ngcols_b}});
+
+  auto t0 = get_t0();
+  auto fm_a = get_fm(gm->get_grid("Point Grid A"),t0);
+  auto fm_b = get_fm(gm->get_grid("Point Grid B"),t0);
+
+  // Place each station slightly off its column, to check we pick the closest one
+  std::vector<double> lat, lon;
+  for (auto gid : station_gids) {
+    lat.push_back(col_lat(gid,ngcols_a)+0.2*col_dlat(ngcols_a));
+    lon.push_back(0.1);
+  }
+
+  auto om_a = create_om("io_stations_a",lat,lon,fm_a,gm,t0,comm);
+  auto om_b = create_om("io_stations_b",lat,lon,fm_b,gm,t0,comm);
+
+  const int dt = 1;
+  for (auto om : {om_a,om_b}) {
+    om->init_timestep(t0,dt);
+    om->run(t0+dt);
+  }
+  om_a->finalize();
+  om_b->finalize();
+}
+
+void read (const std::string& prefix, const std::vector<int>& station_gids,
+           const ekat::Comm& comm)
+{
+  const auto filename = prefix + ".INSTANT.nsteps_x1.np" + std::to_string(comm.size())
+                      + "." + get_t0().to_string() + ".nc";
+
+  // The file only contains the stations columns, in the order they were given.
+  // The field does not change in time, so we can just check the last snapshot.
+  scorpio::register_file(filename,scorpio::Read);
+  const int nstations = station_gids.size();
+  REQUIRE (scorpio::get_dimlen(filename,"ncol")==nstations);
+  REQUIRE (scorpio::get_dimlen(filename,"lev")==nlevs);
+
+  std::vector<Real> f(nstations*nlevs);
+  scorpio::read_var(filename,"f",f.data());
+  scorpio::release_file(filename);
+
+  for (int s=0; s<nstations; ++s) {
+    for (int ilev=0; ilev<nlevs; ++ilev) {
+      REQUIRE (f[s*nlevs+ilev]==f_val(station_gids[s],ilev));
+    }
+  }
+}
+
+TEST_CASE ("io_stations") {
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::init_subsystem(comm);
+
+  // Stations are not sorted, and are spread across ranks
+  const int ngcols_a = 3*comm.size()+2;
+  const int ngcols_b = 2*ngcols_a-1;
+  const std::vector<int> station_gids_a = {ngcols_a-1, 0, ngcols_a/2};
+  std::vector<int> station_gids_b;
+  for (auto gid : station_gids_a) {
+    station_gids_b.push_back(2*gid);
+  }
+
+  write(station_gids_a,ngcols_a,ngcols_b,comm);
+  read ("io_stations_a",station_gids_a,comm);
+  read ("io_stations_b",station_gids_b,comm);
+
+  scorpio::finalize_subsystem();
+}
+
+} // namespace scream
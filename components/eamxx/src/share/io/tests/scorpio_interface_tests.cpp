@@ -203,6 +203,20 @@ TEST_CASE ("write_and_read") {
     read_var (filename,"var5",var45.data(),1);
     REQUIRE (tgt_var45==var45);
 
+    // Read all time slices at once
+    std::vector<int> var3_all (2);
+    std::vector<double> var2_all (2*dim1*dim2); // Also check dtype conversion
+    REQUIRE_THROWS (read_all_records (filename,"var5",var45.data())); // ERROR: decomposed var
+    read_all_records (filename,"var3",var3_all.data());
+    read_all_records (filename,"var2",var2_all.data());
+    REQUIRE (var3_all[0]==100);
+    REQUIRE (var3_all[1]==200);
+    for (int i=0; i<dim1*dim2; ++i) {
+      REQUIRE (var2_all[i]==100+i);
+      REQUIRE (var2_all[dim1*dim2+i]==200+i);
+    }
+    REQUIRE (get_all_times(filename)==std::vector<double>{0.0,0.5});
+
     // Cleanup
     release_file (filename);
   }
@@ -1,4 +1,5 @@
 #include "share/grid/point_grid.hpp"
+#include "share/grid/spherical_spatial_index.hpp"
 #include "share/io/scorpio_input.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
 #include "share/iop/intensive_observation_period.hpp"
@@ -356,42 +357,29 @@ setup_io_info(const std::string& file_name,
     file_reader.read_variables();
     file_reader.finalize();
 
-    // Find column index of closest lat/lon to target_lat/lon params
-    auto lat_v = fields[0].get_view<Real*>();
-    auto lon_v = fields[1].get_view<Real*>();
+    // Store lat/lon in the io grid, so we can use its spatial index
+    io_grid->set_geometry_data(lat_f);
+    io_grid->set_geometry_data(lon_f);
+
+    // Find rank and column index of closest lat/lon to target_lat/lon params,
+    // using the spatial index of the io grid
     const auto target_lat = m_params.get<Real>("target_latitude");
     const auto target_lon = m_params.get<Real>("target_longitude");
-    using minloc_t = Kokkos::MinLoc<Real,int>;
-    using minloc_value_t = typename minloc_t::value_type;
-    minloc_value_t minloc;
-    Kokkos::parallel_reduce(ncols, KOKKOS_LAMBDA (int icol, minloc_value_t& result) {
-      auto dist = std::abs(lat_v(icol)-target_lat)+std::abs(lon_v(icol)-target_lon);
-      if(dist<result.val) {
-        result.val = dist;
-        result.loc = icol;
-      }
-    }, minloc_t(minloc));
-
-    // Find processor with closest lat/lon match
-    const auto my_rank = m_comm.rank();
-    std::pair<Real, int> min_dist_and_rank = {minloc.val, my_rank};
-    m_comm.all_reduce<std::pair<Real, int>>(&min_dist_and_rank, 1, MPI_MINLOC);
+    std::vector<int> pids, lids;
+    find_closest_columns(*io_grid,{target_lat},{target_lon},pids,lids);
+    const auto min_dist_rank    = pids[0];
+    const auto local_column_idx = lids[0];
 
     // Broadcast closest lat/lon values to all ranks
     const auto lat_v_h = lat_f.get_view<Real*,Host>();
     const auto lon_v_h = lon_f.get_view<Real*,Host>();
-    auto local_column_idx = minloc.loc;
-    auto min_dist_rank = min_dist_and_rank.second;
     Real lat_lon_vals[2];
-    if (my_rank == min_dist_rank) {
+    if (m_comm.rank() == min_dist_rank) {
       lat_lon_vals[0] = lat_v_h(local_column_idx);
       lat_lon_vals[1] = lon_v_h(local_column_idx);
     }
     m_comm.broadcast(lat_lon_vals, 2, min_dist_rank);
 
-    // Set local_column_idx=-1 for mpi ranks not containing minimum lat/lon distance
-    if (my_rank != min_dist_rank) local_column_idx = -1;
-
     // Store closest lat/lon info for this grid, used later when reading ICs
     m_lat_lon_info[grid_name] = ClosestLatLonInfo{lat_lon_vals[0], lat_lon_vals[1], min_dist_rank, local_column_idx};
   }
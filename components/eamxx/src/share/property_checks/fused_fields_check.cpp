@@ -0,0 +1,205 @@
+#include "share/property_checks/fused_fields_check.hpp"
+#include "share/property_checks/field_nan_check.hpp"
+#include "share/property_checks/field_within_interval_check.hpp"
+
+#include "ekat/util/ekat_math_utils.hpp"
+
+#include <sstream>
+
+namespace scream
+{
+
+namespace {
+
+// Fill dims/strides of the field descriptor, using the strided view of the
+// field, so that subfields (e.g., tracers in a group) are handled correctly.
+template<typename DT>
+void set_desc_strides (FusedFieldsCheck::FieldDesc& desc, const Field& f) {
+  auto v = f.get_strided_view<DT>();
+  desc.data = v.data();
+  for (int i=0; i<desc.rank; ++i) {
+    desc.strides[i] = v.stride(i);
+  }
+}
+
+} // anonymous namespace
+
+FusedFieldsCheck::
+FusedFieldsCheck (const std::list<Field>& fields,
+                  const std::vector<std::shared_ptr<const AbstractGrid>>& grids,
+                  const std::vector<double>& lower_bounds,
+                  const std::vector<double>& upper_bounds)
+ : m_grids (grids)
+ , m_lb (lower_bounds)
+ , m_ub (upper_bounds)
+{
+  const int nf = fields.size();
+
+  // Sanity checks
+  EKAT_REQUIRE_MSG (static_cast<int>(grids.size())==nf,
+      "Error in FusedFieldsCheck constructor: fields and grids lists must have the same size.\n"
+      "  - Num fields: " + std::to_string(nf) + "\n"
+      "  - Num grids : " + std::to_string(grids.size()) + "\n");
+  EKAT_REQUIRE_MSG (lower_bounds.size()==upper_bounds.size(),
+      "Error in FusedFieldsCheck constructor: lower/upper bounds lists must have the same size.\n");
+  EKAT_REQUIRE_MSG (lower_bounds.size()==0 or static_cast<int>(lower_bounds.size())==nf,
+      "Error in FusedFieldsCheck constructor: bounds lists must be empty or have one entry per field.\n");
+  if (m_lb.size()==0) {
+    m_lb.resize(nf,-s_max);
+    m_ub.resize(nf, s_max);
+  }
+
+  auto it = fields.begin();
+  for (int i=0; i<nf; ++i, ++it) {
+    const auto& f = *it;
+    const auto& grid = m_grids[i];
+    EKAT_REQUIRE_MSG (supports(f),
+        "Error in FusedFieldsCheck constructor: unsupported field.\n"
+        "  - Field name: " + f.name() + "\n"
+        "  - Field rank: " + std::to_string(f.rank()) + "\n"
+        "  - Field data type: " + e2str(f.data_type()) + "\n");
+    EKAT_REQUIRE_MSG (grid==nullptr || f.get_header().get_identifier().get_grid_name()==grid->name(),
+        "Error! The name of the input grid does not match the grid name stored in the field identifier.\n"
+        "  - Field name: " + f.name() + "\n"
+        "  - Field grid name: " + f.get_header().get_identifier().get_grid_name() + "\n"
+        "  - Input grid name: " + grid->name() + "\n");
+    EKAT_REQUIRE_MSG(m_lb[i] <= m_ub[i],
+        "Error in FusedFieldsCheck constructor: lower bound must be less than or equal to upper bound.\n"
+        "  - Field name: " + f.name() + "\n");
+  }
+
+  // We can't repair anything.
+  set_fields (fields,std::list<bool>(nf,false));
+
+  // Build the device descriptors of all fields
+  m_descs = desc_view_t("fused check descriptors",nf);
+  m_descs_h = Kokkos::create_mirror_view(m_descs);
+  long long total = 0;
+  it = fields.begin();
+  for (int i=0; i<nf; ++i, ++it) {
+    const auto& f = *it;
+    const auto& layout = f.get_header().get_identifier().get_layout();
+    auto& d = m_descs_h(i);
+    d.rank = layout.rank();
+    d.offset = total;
+    for (int k=0; k<d.rank; ++k) {
+      d.dims[k] = layout.dim(k);
+    }
+    d.lb = m_lb[i];
+    d.ub = m_ub[i];
+    switch (d.rank) {
+      case 1: set_desc_strides<const Real*>(d,f);      break;
+      case 2: set_desc_strides<const Real**>(d,f);     break;
+      case 3: set_desc_strides<const Real***>(d,f);    break;
+      case 4: set_desc_strides<const Real****>(d,f);   break;
+      case 5: set_desc_strides<const Real*****>(d,f);  break;
+      case 6: set_desc_strides<const Real******>(d,f); break;
+    }
+    total += layout.size();
+  }
+  EKAT_REQUIRE_MSG (total<std::numeric_limits<int>::max(),
+      "Error in FusedFieldsCheck constructor: total size of the fields exceeds int range.\n");
+  m_total_size = total;
+  Kokkos::deep_copy(m_descs,m_descs_h);
+}
+
+bool FusedFieldsCheck::supports (const Field& f) {
+  return f.data_type()==DataType::RealType and f.rank()>=1 and f.rank()<=MaxRank;
+}
+
+std::string FusedFieldsCheck::name () const {
+  std::string s = "Fused NaN/bounds check for fields";
+  for (const auto& f : fields()) {
+    s += " " + f.name();
+  }
+  return s;
+}
+
+int FusedFieldsCheck::first_fail_idx () const
+{
+  using min_t = Kokkos::Min<int>;
+  constexpr int none = std::numeric_limits<int>::max();
+
+  const auto descs = m_descs;
+  const int nf = descs.extent(0);
+
+  int first = none;
+  Kokkos::parallel_reduce(m_total_size, KOKKOS_LAMBDA(int idx, int& result) {
+    // Find the field this entry belongs to
+    int lo = 0, hi = nf-1;
+    while (lo<hi) {
+      const int mid = (lo+hi+1)/2;
+      if (descs(mid).offset<=idx) {
+        lo = mid;
+      } else {
+        hi = mid-1;
+      }
+    }
+    const auto& d = descs(lo);
+
+    // Unflatten the index within the field, and compute the strided offset
+    int rem = idx - d.offset;
+    int off = 0;
+    for (int k=d.rank-1; k>=0; --k) {
+      off += (rem % d.dims[k])*d.strides[k];
+      rem /= d.dims[k];
+    }
+    const auto v = d.data[off];
+    if (ekat::is_invalid(v) or v<d.lb or v>d.ub) {
+      result = idx<result ? idx : result;
+    }
+  }, min_t(first));
+
+  return first==none ? -1 : first;
+}
+
+PropertyCheck::ResultAndMsg FusedFieldsCheck::check_field (const int ifield) const
+{
+  auto it = fields().begin();
+  std::advance(it,ifield);
+
+  // Check NaN's first, then bounds
+  std::shared_ptr<PropertyCheck> pc = std::make_shared<FieldNaNCheck>(*it,m_grids[ifield]);
+  for (const auto& f : additional_data_fields()) {
+    pc->set_additional_data_field(f);
+  }
+  auto res_and_msg = pc->check();
+  if (res_and_msg.result==CheckResult::Pass) {
+    pc = std::make_shared<FieldWithinIntervalCheck>(*it,m_grids[ifield],m_lb[ifield],m_ub[ifield]);
+    for (const auto& f : additional_data_fields()) {
+      pc->set_additional_data_field(f);
+    }
+    res_and_msg = pc->check();
+  }
+  return res_and_msg;
+}
+
+PropertyCheck::ResultAndMsg FusedFieldsCheck::check() const {
+  const int idx = first_fail_idx();
+
+  PropertyCheck::ResultAndMsg res_and_msg;
+  if (idx<0) {
+    res_and_msg.result = CheckResult::Pass;
+    res_and_msg.msg = "FusedFieldsCheck passed.\n";
+    return res_and_msg;
+  }
+
+  // Find the failing field, and get the detailed info from its own check
+  const int nf = m_descs_h.extent(0);
+  int ifield = nf-1;
+  while (m_descs_h(ifield).offset>idx) {
+    --ifield;
+  }
+  res_and_msg = check_field(ifield);
+
+  EKAT_REQUIRE_MSG (res_and_msg.result!=CheckResult::Pass,
+      "Internal error in FusedFieldsCheck: fused kernel and single-field check disagree.\n"
+      "  - Field name: " + std::next(fields().begin(),ifield)->name() + "\n");
+
+  res_and_msg.result = CheckResult::Fail;
+  res_and_msg.msg = "FusedFieldsCheck failed on field " + std::next(fields().begin(),ifield)->name() + ".\n"
+                  + res_and_msg.msg;
+  return res_and_msg;
+}
+
+} // namespace scream
@@ -0,0 +1,79 @@
+#ifndef SCREAM_FUSED_FIELDS_CHECK_HPP
+#define SCREAM_FUSED_FIELDS_CHECK_HPP
+
+#include "share/property_checks/property_check.hpp"
+#include "share/grid/abstract_grid.hpp"
+#include "share/scream_types.hpp"
+
+#include <limits>
+#include <vector>
+
+namespace scream
+{
+
+// Inspect whether a set of fields contains NaN values or values outside
+// of given (per-field) bounds, using a single reduction kernel over all fields.
+// This is meant to replace many FieldNaNCheck (or non-repairable
+// FieldWithinIntervalCheck) objects on the same process, so that the cost
+// of the checks is one kernel launch rather than one per field.
+// If the check fails, we use the corresponding single-field check on the
+// first failing field, to get the detailed (host) diagnostic message.
+// No repair allowed.
+class FusedFieldsCheck: public PropertyCheck {
+public:
+  static constexpr double s_max = std::numeric_limits<Real>::max();
+
+  // All fields must have Real data type and rank in [1,6]. If bounds vectors
+  // are empty, only NaN values are checked.
+  FusedFieldsCheck (const std::list<Field>& fields,
+                    const std::vector<std::shared_ptr<const AbstractGrid>>& grids,
+                    const std::vector<double>& lower_bounds = {},
+                    const std::vector<double>& upper_bounds = {});
+
+  // The name of the field check
+  std::string name () const override;
+
+  PropertyType type () const override { return PropertyType::PointWise; }
+
+  ResultAndMsg check() const override;
+
+  // Whether a field can be handled by this class
+  static bool supports (const Field& f);
+
+  static constexpr int MaxRank = 6;
+
+  // Description of a field, usable on device
+  struct FieldDesc {
+    const Real* data;
+    int rank;
+    int offset;  // offset of the field in the flattened index space of all fields
+    int dims[MaxRank];
+    int strides[MaxRank];
+    Real lb, ub;
+  };
+
+// CUDA requires the parent fcn of a KOKKOS_LAMBDA to have public access
+#ifndef EAMXX_ENABLE_GPU
+protected:
+#endif
+  // Returns the global flattened index of the first failing entry, or -1 if none fails
+  int first_fail_idx () const;
+
+protected:
+
+  // Runs the detailed single-field check on the given field
+  ResultAndMsg check_field (const int ifield) const;
+
+  using desc_view_t = KokkosTypes<DefaultDevice>::view_1d<FieldDesc>;
+
+  std::vector<std::shared_ptr<const AbstractGrid>>  m_grids;
+  std::vector<double>   m_lb, m_ub;
+
+  desc_view_t                     m_descs;
+  typename desc_view_t::HostMirror m_descs_h;
+  int                             m_total_size;
+};
+
+} // namespace scream
+
+#endif // SCREAM_FUSED_FIELDS_CHECK_HPP
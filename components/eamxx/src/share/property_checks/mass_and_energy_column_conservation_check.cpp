@@ -34,6 +34,7 @@ MassAndEnergyColumnConservationCheck (const std::shared_ptr<const AbstractGrid>&
 
   m_current_mass   = view_1d<Real> ("current_total_water",  m_num_cols);
   m_current_energy = view_1d<Real> ("current_total_energy", m_num_cols);
+  m_column_errors  = view_2d<Real> ("column_errors", m_num_cols, 2);
 
   m_fields["pseudo_density"] = pseudo_density;
   m_fields["ps"]             = ps;
@@ -107,7 +108,47 @@ void MassAndEnergyColumnConservationCheck::compute_current_energy ()
   });
 }
 
-PropertyCheck::ResultAndMsg MassAndEnergyColumnConservationCheck::check() const
+void MassAndEnergyColumnConservationCheck::compute_current_mass_and_energy ()
+{
+  auto mass   = m_current_mass;
+  auto energy = m_current_energy;
+  const auto ncols = m_num_cols;
+  const auto nlevs = m_num_levs;
+
+  const auto pseudo_density = m_fields.at("pseudo_density").get_view<const Real**>();
+  const auto T_mid = m_fields.at("T_mid").get_view<const Real**>();
+  const auto horiz_winds = m_fields.at("horiz_winds").get_view<const Real***>();
+  const auto qv = m_fields.at("qv").get_view<const Real**>();
+  const auto qc = m_fields.at("qc").get_view<const Real**>();
+  const auto qi = m_fields.at("qi").get_view<const Real**>();
+  const auto qr = m_fields.at("qr").get_view<const Real**>();
+  const auto ps = m_fields.at("ps").get_view<const Real*>();
+  const auto phis = m_fields.at("phis").get_view<const Real*>();
+
+  const auto policy = ExeSpaceUtils::get_default_team_policy(ncols, nlevs);
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA (const KT::MemberType& team) {
+    const int i = team.league_rank();
+
+    const auto pseudo_density_i = ekat::subview(pseudo_density, i);
+    const auto T_mid_i          = ekat::subview(T_mid, i);
+    const auto horiz_winds_i    = ekat::subview(horiz_winds, i);
+    const auto qv_i             = ekat::subview(qv, i);
+    const auto qc_i             = ekat::subview(qc, i);
+    const auto qi_i             = ekat::subview(qi, i);
+    const auto qr_i             = ekat::subview(qr, i);
+
+    const Real tm = compute_total_mass_on_column(team, nlevs, pseudo_density_i, qv_i, qc_i, qi_i, qr_i);
+    const Real te = compute_total_energy_on_column(team, nlevs, pseudo_density_i, T_mid_i, horiz_winds_i,
+                                                   qv_i, qc_i, qr_i, ps(i), phis(i));
+    Kokkos::single(Kokkos::PerTeam(team),[&]() {
+      mass(i)   = tm;
+      energy(i) = te;
+    });
+  });
+}
+
+void MassAndEnergyColumnConservationCheck::
+compute_column_errors (const view_2d<Real>& errors, const bool accumulate) const
 {
   auto mass   = m_current_mass;
   auto energy = m_current_energy;
@@ -133,19 +174,14 @@ PropertyCheck::ResultAndMsg MassAndEnergyColumnConservationCheck::check() const
   const auto ice_flux   = m_fields.at("ice_flux"  ).get_view<const Real*>();
   const auto heat_flux  = m_fields.at("heat_flux" ).get_view<const Real*>();
 
-  // Use Kokkos::MaxLoc to find the largest error for both mass and energy
-  using maxloc_t = Kokkos::MaxLoc<Real, int>;
-  using maxloc_value_t = typename maxloc_t::value_type;
-  maxloc_value_t maxloc_mass;
-  maxloc_value_t maxloc_energy;
-
-  // Mass error calculation
+  // Mass and energy errors are computed in the same kernel
   const auto policy = ExeSpaceUtils::get_default_team_policy(ncols, nlevs);
-  Kokkos::parallel_reduce(policy, KOKKOS_LAMBDA (const KT::MemberType& team,
-                                                 maxloc_value_t&       result) {
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA (const KT::MemberType& team) {
     const int i = team.league_rank();
 
     const auto pseudo_density_i = ekat::subview(pseudo_density, i);
+    const auto T_mid_i          = ekat::subview(T_mid, i);
+    const auto horiz_winds_i    = ekat::subview(horiz_winds, i);
     const auto qv_i             = ekat::subview(qv, i);
     const auto qc_i             = ekat::subview(qc, i);
     const auto qi_i             = ekat::subview(qi, i);
@@ -165,26 +201,6 @@ PropertyCheck::ResultAndMsg MassAndEnergyColumnConservationCheck::check() const
     // Calculate relative error of total mass
     const Real rel_err_mass = std::abs(tm-tm_exp)/previous_tm;
 
-    // Test relative error against current max value
-    if (rel_err_mass > result.val) {
-      result.val = rel_err_mass;
-      result.loc = i;
-    }
-  }, maxloc_t(maxloc_mass));
-
-  // Energy error calculation
-  Kokkos::parallel_reduce(policy, KOKKOS_LAMBDA (const KT::MemberType& team,
-                                                 maxloc_value_t&       result) {
-
-    const int i = team.league_rank();
-
-    const auto pseudo_density_i = ekat::subview(pseudo_density, i);
-    const auto T_mid_i          = ekat::subview(T_mid, i);
-    const auto horiz_winds_i    = ekat::subview(horiz_winds, i);
-    const auto qv_i             = ekat::subview(qv, i);
-    const auto qc_i             = ekat::subview(qc, i);
-    const auto qr_i             = ekat::subview(qr, i);
-
     // Calculate total energy
     const Real te = compute_total_energy_on_column(team, nlevs, pseudo_density_i, T_mid_i, horiz_winds_i,
                                                    qv_i, qc_i, qr_i, ps(i), phis(i));
@@ -197,13 +213,114 @@ PropertyCheck::ResultAndMsg MassAndEnergyColumnConservationCheck::check() const
     // Calculate relative error of total energy
     const Real rel_err_energy = std::abs(te-te_exp)/previous_te;
 
-    // Test relative error against current max value
-    if (rel_err_energy > result.val) {
-      result.val = rel_err_energy;
-      result.loc = i;
+    Kokkos::single(Kokkos::PerTeam(team),[&]() {
+      if (accumulate) {
+        // Keep the largest errors since the last reset
+        if (rel_err_mass > errors(i,0)) {
+          errors(i,0) = rel_err_mass;
+        }
+        if (rel_err_energy > errors(i,1)) {
+          errors(i,1) = rel_err_energy;
+        }
+      } else {
+        errors(i,0) = rel_err_mass;
+        errors(i,1) = rel_err_energy;
+      }
+    });
+  });
+}
+
+void MassAndEnergyColumnConservationCheck::
+find_max_errors (const view_2d<const Real>& errors,
+                 maxloc_value_t& maxloc_mass,
+                 maxloc_value_t& maxloc_energy) const
+{
+  // Use Kokkos::MaxLoc to find the largest error for both mass and energy
+  const auto policy = Kokkos::RangePolicy<KT::ExeSpace>(0,m_num_cols);
+  Kokkos::parallel_reduce(policy, KOKKOS_LAMBDA (const int i,
+                                                 maxloc_value_t& result_mass,
+                                                 maxloc_value_t& result_energy) {
+    // Test relative errors against current max values
+    if (errors(i,0) > result_mass.val) {
+      result_mass.val = errors(i,0);
+      result_mass.loc = i;
+    }
+    if (errors(i,1) > result_energy.val) {
+      result_energy.val = errors(i,1);
+      result_energy.loc = i;
     }
-  }, maxloc_t(maxloc_energy));
+  }, maxloc_t(maxloc_mass), maxloc_t(maxloc_energy));
+}
+
+void MassAndEnergyColumnConservationCheck::set_deferred (const bool deferred)
+{
+  EKAT_REQUIRE_MSG (m_deferred_errors.empty(),
+      "Error! Cannot change deferred mode after processes have been registered.\n");
+  m_deferred = deferred;
+}
 
+void MassAndEnergyColumnConservationCheck::
+register_process (const std::string& proc_name)
+{
+  EKAT_REQUIRE_MSG (m_deferred_errors.count(proc_name)==0,
+      "Error! Process '" + proc_name + "' was already registered in the column conservation check.\n");
+  if (m_deferred) {
+    m_deferred_errors[proc_name] = view_2d<Real>("deferred_column_errors_"+proc_name,m_num_cols,2);
+  } else {
+    m_deferred_errors[proc_name] = view_2d<Real>();
+  }
+}
+
+void MassAndEnergyColumnConservationCheck::
+set_current_process (const std::string& proc_name)
+{
+  EKAT_REQUIRE_MSG (m_deferred_errors.count(proc_name)==1,
+      "Error! Process '" + proc_name + "' was not registered in the column conservation check.\n");
+  m_current_process = proc_name;
+}
+
+PropertyCheck::ResultAndMsg MassAndEnergyColumnConservationCheck::check_deferred() const
+{
+  EKAT_REQUIRE_MSG (m_deferred,
+      "Error! MassAndEnergyColumnConservationCheck::check_deferred called, but deferred mode is off.\n");
+
+  const auto& errors = m_deferred_errors.at(m_current_process);
+  maxloc_value_t maxloc_mass;
+  maxloc_value_t maxloc_energy;
+  find_max_errors(errors,maxloc_mass,maxloc_energy);
+  Kokkos::deep_copy(errors,0);
+
+  auto res_and_msg = build_result_and_msg(maxloc_mass,maxloc_energy);
+  if (res_and_msg.result!=CheckResult::Pass) {
+    res_and_msg.msg += "  - NOTE: errors are the largest ones since the previous end of step.\n"
+                       "          Additional data is the one at the end of the step.\n";
+  }
+  return res_and_msg;
+}
+
+PropertyCheck::ResultAndMsg MassAndEnergyColumnConservationCheck::check() const
+{
+  if (m_deferred) {
+    // Only accumulate the errors on device. They are tested in check_deferred.
+    compute_column_errors(m_deferred_errors.at(m_current_process),true);
+
+    PropertyCheck::ResultAndMsg res_and_msg;
+    res_and_msg.result = CheckResult::Pass;
+    return res_and_msg;
+  }
+
+  maxloc_value_t maxloc_mass;
+  maxloc_value_t maxloc_energy;
+  compute_column_errors(m_column_errors,false);
+  find_max_errors(m_column_errors,maxloc_mass,maxloc_energy);
+
+  return build_result_and_msg(maxloc_mass,maxloc_energy);
+}
+
+PropertyCheck::ResultAndMsg MassAndEnergyColumnConservationCheck::
+build_result_and_msg (const maxloc_value_t& maxloc_mass,
+                      const maxloc_value_t& maxloc_energy) const
+{
   // Check if mass and/or energy values were below tolerance.
   const bool mass_below_tol   = (maxloc_mass.val   < m_mass_tol);
   const bool energy_below_tol = (maxloc_energy.val < m_energy_tol);
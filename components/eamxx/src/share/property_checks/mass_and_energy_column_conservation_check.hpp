@@ -52,8 +52,25 @@ public:
   PropertyType type () const override { return PropertyType::ColumnWise; }
 
   // Computes mass and energy and tests against a tolerance.
+  // In deferred mode, the column errors are only accumulated on device (see
+  // check_deferred), and this method always returns Pass.
   ResultAndMsg check () const override;
 
+  // If true, check() does not bring the errors to host. Instead, it keeps, for
+  // each column, the largest errors of the current process, which are then
+  // tested against the tolerances by check_deferred.
+  void set_deferred (const bool deferred);
+  bool is_deferred () const { return m_deferred; }
+
+  // Each process that runs this check must be registered, and must set itself
+  // as the current process before computing mass/energy and running the check.
+  void register_process (const std::string& proc_name);
+  void set_current_process (const std::string& proc_name);
+
+  // Tests the errors accumulated for the current process since the last call
+  // against the tolerances, and resets them. Only valid in deferred mode.
+  ResultAndMsg check_deferred () const;
+
   std::shared_ptr<const AbstractGrid> get_grid () const { return m_grid; }
 
   // Set the timestep for the process running the check. This
@@ -73,11 +90,32 @@ public:
   // in m_fields.
   void compute_current_energy ();
 
+  // Same as calling compute_current_mass and compute_current_energy,
+  // but with a single kernel.
+  void compute_current_mass_and_energy ();
+
 // CUDA requires the parent fcn of a KOKKOS_LAMBDA to have public access
 #ifndef KOKKOS_ENABLE_CUDA
   protected:
 #endif
 
+  using maxloc_t = Kokkos::MaxLoc<Real, int>;
+  using maxloc_value_t = typename maxloc_t::value_type;
+
+  // Compute the relative mass/energy errors of each local column, and store them
+  // in errors(:,0) and errors(:,1) respectively. If accumulate=true, the stored
+  // errors are only replaced if the new ones are larger.
+  void compute_column_errors (const view_2d<Real>& errors, const bool accumulate) const;
+
+  // Find the max relative mass/energy errors (and their location) over all local columns.
+  void find_max_errors (const view_2d<const Real>& errors,
+                        maxloc_value_t& maxloc_mass,
+                        maxloc_value_t& maxloc_energy) const;
+
+  // Compare the max errors with the tolerances, and build the output message
+  ResultAndMsg build_result_and_msg (const maxloc_value_t& maxloc_mass,
+                                     const maxloc_value_t& maxloc_energy) const;
+
   KOKKOS_INLINE_FUNCTION
   static Real compute_total_mass_on_column (const KT::MemberType&       team,
                                             const int                   nlevs,
@@ -124,6 +162,15 @@ protected:
   // should be updated before a process is run.
   view_1d<Real> m_current_energy;
   view_1d<Real> m_current_mass;
+
+  // Relative mass/energy errors of each column, from the last call to check()
+  view_2d<Real> m_column_errors;
+
+  // In deferred mode, the largest relative mass/energy errors of each column,
+  // for each registered process, since the last call to check_deferred.
+  bool m_deferred = false;
+  std::string m_current_process;
+  std::map<std::string,view_2d<Real>> m_deferred_errors;
 }; // class EnergyConservationCheck
 
 } // namespace scream
@@ -580,6 +580,12 @@ TEST_CASE ("subcycling") {
   for (size_t i=0; i<v.size(); ++i) {
     REQUIRE (v_sub[i]==5*v[i]);
   }
+
+  // Customers must be able to tell that the output changed after each subcycle
+  const auto& track = ap->get_fields_out().front().get_header().get_tracking();
+  const auto& track_sub = ap_sub->get_fields_out().front().get_header().get_tracking();
+  REQUIRE (track.get_num_updates()==1);
+  REQUIRE (track_sub.get_num_updates()==5);
 }
 
 TEST_CASE ("diagnostics") {
@@ -502,4 +502,72 @@ TEST_CASE("coarsening_remap")
   scorpio::finalize_subsystem();
 }
 
+TEST_CASE("coarsening_remap_triplets")
+{
+  // Check that the remapper can be built from in-memory triplets, which is
+  // what the IO layer does for station output. Each tgt dof samples a single src dof.
+
+  using gid_type = AbstractGrid::gid_type;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  root_print ("\n +-------------------------------------------------+\n",comm);
+  root_print (" |   Testing coarsening remapper (from triplets)   |\n",comm);
+  root_print (" +-------------------------------------------------+\n\n",comm);
+
+  scorpio::init_subsystem(comm);
+  auto engine = setup_random_test (&comm);
+
+  const int ngdofs_tgt = 3*comm.size();
+  const int ngdofs_src = 2*ngdofs_tgt+1;
+  auto src_grid = build_src_grid(comm, ngdofs_src, engine);
+
+  // Tgt dof i samples src dof 2*i+1. Only the owner of the src dof adds the triplet
+  auto src_gids_h = src_grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  auto src_gids_beg = src_gids_h.data();
+  auto src_gids_end = src_gids_beg+src_gids_h.size();
+  std::vector<gid_type> rows, cols;
+  std::vector<Real> S;
+  for (int i=0; i<ngdofs_tgt; ++i) {
+    const gid_type col = 2*i+1;
+    if (std::find(src_gids_beg,src_gids_end,col)!=src_gids_end) {
+      rows.push_back(i);
+      cols.push_back(col);
+      S.push_back(1);
+    }
+  }
+  auto remap = std::make_shared<CoarseningRemapper>(src_grid,"cr_tests_triplets",rows,cols,S);
+  auto tgt_grid = remap->get_tgt_grid();
+  REQUIRE (tgt_grid->get_num_global_dofs()==ngdofs_tgt);
+
+  auto src_s3d = create_field("s3d",LayoutType::Scalar3D, *src_grid, true,  engine);
+  auto tgt_s3d = create_field("s3d",LayoutType::Scalar3D, *tgt_grid, true );
+
+  remap->registration_begins();
+  remap->register_field(src_s3d,tgt_s3d);
+  remap->registration_ends();
+  remap->remap(true);
+
+  auto gids_tgt = all_gather_field(tgt_grid->get_dofs_gids(),comm);
+  auto gids_src = all_gather_field(src_grid->get_dofs_gids(),comm);
+  auto gids_src_v = gids_src.get_view<const gid_type*,Host>();
+  auto gids_tgt_v = gids_tgt.get_view<const gid_type*,Host>();
+  auto gsrc = all_gather_field(src_s3d,comm);
+  auto gtgt = all_gather_field(tgt_s3d,comm);
+  const auto v_src = gsrc.get_view<const Real**,Host>();
+  const auto v_tgt = gtgt.get_view<const Real**,Host>();
+  const int nlevs = src_grid->get_num_vertical_levels();
+  for (int idof=0; idof<ngdofs_tgt; ++idof) {
+    const auto src_gcol = 2*gids_tgt_v(idof)+1;
+    auto data = gids_src_v.data();
+    const auto src_lcol = std::distance(data,std::find(data,data+gids_src_v.size(),src_gcol));
+    for (int ilev=0; ilev<nlevs; ++ilev) {
+      REQUIRE (v_tgt(idof,ilev)==v_src(src_lcol,ilev));
+    }
+  }
+
+  // Clean up scorpio stuff
+  scorpio::finalize_subsystem();
+}
+
 } // namespace scream
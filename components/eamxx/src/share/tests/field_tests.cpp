@@ -106,6 +106,12 @@ TEST_CASE("field_tracking", "") {
 
   // Cannot rewind time (yet)
   REQUIRE_THROWS  (track.update_time_stamp(time1));
+
+  // Updates counter is independent of the time stamp
+  REQUIRE (track.get_num_updates()==0);
+  track.mark_updated();
+  track.mark_updated();
+  REQUIRE (track.get_num_updates()==2);
 }
 
 TEST_CASE("field", "") {
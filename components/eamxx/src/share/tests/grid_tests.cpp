@@ -4,12 +4,14 @@
 #include "share/grid/se_grid.hpp"
 #include "share/grid/mesh_free_grids_manager.hpp"
 #include "share/grid/grid_utils.hpp"
+#include "share/grid/spherical_spatial_index.hpp"
 #include "share/util/scream_setup_random_test.hpp"
 #include "share/scream_types.hpp"
 
 #include "ekat/ekat_pack.hpp"
 
 #include <algorithm>
+#include <cmath>
 
 namespace {
 
@@ -218,4 +220,84 @@ TEST_CASE ("get_remote_pids_and_lids") {
   }
 }
 
+TEST_CASE ("spatial_index") {
+  using gid_type = AbstractGrid::gid_type;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  auto engine = setup_random_test(&comm);
+
+  const int num_local_dofs = 200;
+  const int num_global_dofs = num_local_dofs*comm.size();
+  auto grid = create_point_grid("my_grid",num_global_dofs,1,comm);
+
+  // Spread points quasi-uniformly on the sphere (Fibonacci lattice), so that
+  // all ranks can compute the global set of points, and there are no ties.
+  const Real golden = (1+std::sqrt(5.0))/2;
+  auto lat_of = [&](const int i) {
+    return std::asin(2*(i+0.5)/num_global_dofs - 1)*180/M_PI;
+  };
+  auto lon_of = [&](const int i) {
+    const Real x = i/golden;
+    return (x-std::floor(x))*360;
+  };
+
+  auto nondim = ekat::units::Units::nondimensional();
+  auto lat = grid->create_geometry_data("lat",grid->get_2d_scalar_layout(),nondim);
+  auto lon = grid->create_geometry_data("lon",grid->get_2d_scalar_layout(),nondim);
+  auto lat_h = lat.get_view<Real*,Host>();
+  auto lon_h = lon.get_view<Real*,Host>();
+  auto gids_h = grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  for (int i=0; i<num_local_dofs; ++i) {
+    lat_h(i) = lat_of(gids_h(i));
+    lon_h(i) = lon_of(gids_h(i));
+  }
+  lat.sync_to_dev();
+  lon.sync_to_dev();
+
+  // Random targets, plus a couple of exact matches and points across the date line
+  const int num_tgts = 100;
+  std::uniform_real_distribution<Real> pdf_lat(-90,90), pdf_lon(0,360);
+  std::vector<Real> tgt_lat(num_tgts), tgt_lon(num_tgts);
+  for (int i=0; i<num_tgts; ++i) {
+    tgt_lat[i] = pdf_lat(engine);
+    tgt_lon[i] = pdf_lon(engine);
+  }
+  comm.broadcast(tgt_lat.data(),num_tgts,0);
+  comm.broadcast(tgt_lon.data(),num_tgts,0);
+  tgt_lat[0] = lat_of(num_global_dofs/3);
+  tgt_lon[0] = lon_of(num_global_dofs/3);
+  tgt_lat[1] = 10;  tgt_lon[1] = 359.99;
+  tgt_lat[2] = -10; tgt_lon[2] = 0.01;
+  tgt_lat[3] = 89.99;
+
+  std::vector<int> pids, lids;
+  std::vector<Real> dist;
+  find_closest_columns(*grid,tgt_lat,tgt_lon,pids,lids,&dist);
+  REQUIRE (static_cast<int>(pids.size())==num_tgts);
+  REQUIRE (static_cast<int>(lids.size())==num_tgts);
+  REQUIRE (grid->get_spatial_index()->size()==num_local_dofs);
+
+  for (int i=0; i<num_tgts; ++i) {
+    // Brute force search over the global set of points
+    int best = -1;
+    Real best_dist = std::numeric_limits<Real>::max();
+    for (int g=0; g<num_global_dofs; ++g) {
+      const auto d = SphericalSpatialIndex::distance(tgt_lat[i],tgt_lon[i],lat_of(g),lon_of(g));
+      if (d<best_dist) {
+        best = g;
+        best_dist = d;
+      }
+    }
+    REQUIRE (pids[i]==best / num_local_dofs);
+    REQUIRE (dist[i]==Approx(best_dist).margin(1e-6));
+    if (comm.rank()==pids[i]) {
+      REQUIRE (gids_h(lids[i])==best);
+    } else {
+      REQUIRE (lids[i]==-1);
+    }
+  }
+  REQUIRE (dist[0]==Approx(0).margin(1e-6));
+}
+
 } // anonymous namespace
@@ -5,6 +5,7 @@
 #include "share/property_checks/field_lower_bound_check.hpp"
 #include "share/property_checks/field_upper_bound_check.hpp"
 #include "share/property_checks/field_nan_check.hpp"
+#include "share/property_checks/fused_fields_check.hpp"
 #include "share/util/scream_setup_random_test.hpp"
 #include "share/grid/point_grid.hpp"
 #include "share/field/field_utils.hpp"
@@ -311,6 +312,41 @@ TEST_CASE("property_checks", "") {
       REQUIRE(f_data[i] == 1.0);
     }
   }
+
+  // Check NaN and bounds of multiple fields with a single kernel
+  SECTION ("fused_fields_check") {
+    FieldIdentifier gid ("field_2", {{COL,LEV},{num_lcols,nlevs}}, m/s,"some_grid");
+    Field g(gid);
+    g.allocate_view();
+
+    auto fused_check = std::make_shared<FusedFieldsCheck>(std::list<Field>{f,g},
+                                                          std::vector<std::shared_ptr<const AbstractGrid>>{grid,grid},
+                                                          std::vector<double>{0,-FusedFieldsCheck::s_max},
+                                                          std::vector<double>{1, FusedFieldsCheck::s_max});
+    REQUIRE(not fused_check->can_repair());
+
+    // Assign in-bound values to the fields and make sure the check passes
+    f.deep_copy(0.5);
+    g.deep_copy(-10.0);
+    auto res_and_msg = fused_check->check();
+    REQUIRE(res_and_msg.result==CheckResult::Pass);
+
+    // A NaN in the second field is detected, with the correct location
+    auto g_view = g.get_strided_view<Real**,Host>();
+    g_view(1,5) = std::numeric_limits<Real>::quiet_NaN();
+    g.sync_to_dev();
+    res_and_msg = fused_check->check();
+    REQUIRE(res_and_msg.result==CheckResult::Fail);
+    REQUIRE(res_and_msg.fail_loc_indices==std::vector<int>{1,5});
+
+    // An out-of-bounds value in the first field is detected first
+    auto f_view = f.get_strided_view<Real***,Host>();
+    f_view(1,2,3) = 2.0;
+    f.sync_to_dev();
+    res_and_msg = fused_check->check();
+    REQUIRE(res_and_msg.result==CheckResult::Fail);
+    REQUIRE(res_and_msg.fail_loc_indices==std::vector<int>{1,2,3});
+  }
 }
 
 } // anonymous namespace
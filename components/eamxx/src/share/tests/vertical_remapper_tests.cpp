@@ -80,6 +80,27 @@ void create_remap_file(const std::string& filename, const int nlevs, const std::
   scorpio::release_file(filename);
 }
 
+// Helper function to create a remap file for conservative remap
+void create_cons_remap_file(const std::string& filename, const std::vector<Real>& pint_tgt)
+{
+  const int nlevs = pint_tgt.size()-1;
+  std::vector<Real> p_tgt;
+  for (int k=0; k<nlevs; ++k) {
+    p_tgt.push_back((pint_tgt[k]+pint_tgt[k+1])/2);
+  }
+  scorpio::register_file(filename, scorpio::FileMode::Write);
+  scorpio::define_dim(filename,"lev",nlevs);
+  scorpio::define_dim(filename,"ilev",nlevs+1);
+  scorpio::define_var(filename,"p_levs",{"lev"},"real");
+  scorpio::define_var(filename,"p_ilevs",{"ilev"},"real");
+  scorpio::enddef(filename);
+
+  scorpio::write_var(filename,"p_levs",p_tgt.data());
+  scorpio::write_var(filename,"p_ilevs",pint_tgt.data());
+
+  scorpio::release_file(filename);
+}
+
 TEST_CASE ("vertical_remap") {
   using gid_type = AbstractGrid::gid_type;
 
@@ -359,4 +380,140 @@ TEST_CASE ("vertical_remap") {
   scorpio::finalize_subsystem();
 }
 
+TEST_CASE ("vertical_remap_conservative") {
+  using namespace ShortFieldTagsNames;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  scorpio::init_subsystem(comm);
+
+  const int nlevs_src  = 2*SCREAM_PACK_SIZE + 2;
+  const int nlevs_tgt  = nlevs_src/2 + 2; // Ensures some tgt layers are below the src column
+  const int nldofs_src = 10;
+  const Real mask_val  = -99999.0;
+  constexpr int vec_dim = 3;
+
+  // Src layers have unit thickness, starting at p=0. Tgt layers have thickness 2.5,
+  // starting at p=0.5, so that they partially overlap several src layers.
+  std::vector<Real> pint_tgt;
+  for (int k=0; k<=nlevs_tgt; ++k) {
+    pint_tgt.push_back(0.5 + 2.5*k);
+  }
+  std::string filename = "vertical_cons_map_file_np" + std::to_string(comm.size()) + ".nc";
+  create_cons_remap_file(filename, pint_tgt);
+
+  auto src_grid = build_src_grid(comm, nldofs_src, nlevs_src);
+  auto pmid_src = create_field("p_mid", src_grid, false, false, true,  SCREAM_PACK_SIZE);
+  auto pint_src = create_field("p_int", src_grid, false, false, false, SCREAM_PACK_SIZE);
+  auto pmid_v = pmid_src.get_view<Real**,Host>();
+  auto pint_v = pint_src.get_view<Real**,Host>();
+  for (int i=0; i<nldofs_src; ++i) {
+    for (int k=0; k<=nlevs_src; ++k) {
+      pint_v(i,k) = k;
+    }
+    for (int k=0; k<nlevs_src; ++k) {
+      pmid_v(i,k) = k + 0.5;
+    }
+  }
+  pmid_src.sync_to_dev();
+  pint_src.sync_to_dev();
+
+  auto remap = std::make_shared<VerticalRemapper>(src_grid,filename,pmid_src,pint_src,mask_val);
+  REQUIRE (remap->is_conservative());
+
+  auto tgt_grid = remap->get_tgt_grid();
+  REQUIRE(tgt_grid->get_num_vertical_levels()==nlevs_tgt);
+
+  auto src_s2d   = create_field("s2d",  src_grid,true,false);
+  auto src_s3d_m = create_field("s3d_m",src_grid,false,false,true,1);
+  auto src_v3d_m = create_field("v3d_m",src_grid,false,true ,true,SCREAM_PACK_SIZE);
+  auto src_s3d_i = create_field("s3d_i",src_grid,false,false,false,1);
+  auto tgt_s2d   = create_field("s2d",  tgt_grid,true,false);
+  auto tgt_s3d_m = create_field("s3d_m",tgt_grid,false,false,true,1);
+  auto tgt_v3d_m = create_field("v3d_m",tgt_grid,false,true ,true,SCREAM_PACK_SIZE);
+  auto tgt_s3d_i = create_field("s3d_i",tgt_grid,false,false,true,1);
+
+  remap->registration_begins();
+  remap->register_field(src_s2d,  tgt_s2d);
+  remap->register_field(src_s3d_m,tgt_s3d_m);
+  remap->register_field(src_v3d_m,tgt_v3d_m);
+  REQUIRE_THROWS (remap->register_field(src_s3d_i,tgt_s3d_i)); // Interface fields not supported
+  remap->registration_ends();
+
+  // Fill src fields
+  {
+    auto s2d = src_s2d.get_view<Real*,Host>();
+    auto s3d = src_s3d_m.get_view<Real**,Host>();
+    auto v3d = src_v3d_m.get_view<Real***,Host>();
+    for (int i=0; i<nldofs_src; ++i) {
+      s2d(i) = data_func(i,0,0);
+      for (int k=0; k<nlevs_src; ++k) {
+        // Make the data nonlinear in p, so that the test is not trivial
+        s3d(i,k) = data_func(i,0,pmid_v(i,k)*pmid_v(i,k));
+        for (int j=0; j<vec_dim; ++j) {
+          v3d(i,j,k) = data_func(i,j+1,pmid_v(i,k)*pmid_v(i,k));
+        }
+      }
+    }
+    src_s2d.sync_to_dev();
+    src_s3d_m.sync_to_dev();
+    src_v3d_m.sync_to_dev();
+  }
+
+  // Compute the expected layer average on host
+  auto expected = [&](const int i, const int icmp, const int k, Real& val) -> bool {
+    Real sum = 0, dp = 0;
+    for (int j=0; j<nlevs_src; ++j) {
+      const Real t = std::max(pint_tgt[k],pint_v(i,j));
+      const Real b = std::min(pint_tgt[k+1],pint_v(i,j+1));
+      if (b>t) {
+        sum += (b-t)*data_func(i,icmp,pmid_v(i,j)*pmid_v(i,j));
+        dp  += b-t;
+      }
+    }
+    val = dp>0 ? sum/dp : 0;
+    return dp>0;
+  };
+
+  for (int irun=0; irun<2; ++irun) {
+    remap->remap(true);
+
+    tgt_s2d.sync_to_host();
+    tgt_s3d_m.sync_to_host();
+    tgt_v3d_m.sync_to_host();
+    auto s2d_src = src_s2d.get_view<const Real*,Host>();
+    auto s2d = tgt_s2d.get_view<const Real*,Host>();
+    auto s3d = tgt_s3d_m.get_view<const Real**,Host>();
+    auto v3d = tgt_v3d_m.get_view<const Real***,Host>();
+    auto mask = tgt_s3d_m.get_header().get_extra_data<Field>("mask_data");
+    mask.sync_to_host();
+    auto mask_v = mask.get_view<const Real**,Host>();
+    int num_masked = 0;
+    for (int i=0; i<nldofs_src; ++i) {
+      REQUIRE (s2d(i)==s2d_src(i));
+      for (int k=0; k<nlevs_tgt; ++k) {
+        Real val;
+        if (expected(i,0,k,val)) {
+          REQUIRE (s3d(i,k)==Approx(val).epsilon(1e-10));
+          REQUIRE (mask_v(i,k)==Approx(1.0).epsilon(1e-10));
+        } else {
+          REQUIRE (s3d(i,k)==mask_val);
+          REQUIRE (mask_v(i,k)==0);
+          ++num_masked;
+        }
+        for (int j=0; j<vec_dim; ++j) {
+          if (expected(i,j+1,k,val)) {
+            REQUIRE (v3d(i,j,k)==Approx(val).epsilon(1e-10));
+          } else {
+            REQUIRE (v3d(i,j,k)==mask_val);
+          }
+        }
+      }
+    }
+    REQUIRE (num_masked>0);
+  }
+
+  scorpio::finalize_subsystem();
+}
+
 } // namespace scream
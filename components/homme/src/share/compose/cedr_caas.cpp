@@ -36,9 +36,12 @@ namespace caas {
 
 template <typename ES>
 CAAS<ES>::CAAS (const mpi::Parallel::Ptr& p, const Int nlclcells,
-                const typename UserAllReducer::Ptr& uar) {
+                const typename UserAllReducer::Ptr& uar,
+                const bool node_aware_all_reduce) {
   p_ = p;
   user_reducer_ = uar;
+  if (node_aware_all_reduce && ! uar)
+    node_topo_ = std::make_shared<mpi::NodeTopology>(*p);
   o.nlclcells_ = nlclcells;
   o.nrhomidxs_ = 0;
   o.need_conserve_ = false;
@@ -202,8 +205,9 @@ void CAAS<ES>::reduce_locally () {
 
 template <typename ES>
 void CAAS<ES>::reduce_globally () {
-  const int err = mpi::all_reduce(*p_, send_.data(), recv_.data(),
-                                  send_.size(), MPI_SUM);
+  const int err = node_topo_ ?
+    mpi::all_reduce(*node_topo_, send_.data(), recv_.data(), send_.size(), MPI_SUM) :
+    mpi::all_reduce(*p_, send_.data(), recv_.data(), send_.size(), MPI_SUM);
   cedr_throw_if(err != MPI_SUCCESS,
                 "CAAS::reduce_globally MPI_Allreduce returned " << err);
 }
@@ -302,7 +306,7 @@ struct TestCAAS : public cedr::test::TestRandomized {
 
   TestCAAS (const mpi::Parallel::Ptr& p, const Int& ncells,
             const bool use_own_reducer, const bool external_memory,
-            const bool verbose)
+            const bool verbose, const bool node_aware = false)
     : TestRandomized("CAAS", p, ncells, verbose),
       p_(p), external_memory_(external_memory)
   {
@@ -319,7 +323,7 @@ struct TestCAAS : public cedr::test::TestRandomized {
                            nlclcells_ % 2 == 0 ? 2 : 1);
       reducer = std::make_shared<TestAllReducer>(n_accum);
     }
-    caas_ = std::make_shared<CAAST>( p, nlclcells_, reducer);
+    caas_ = std::make_shared<CAAST>( p, nlclcells_, reducer, node_aware);
     init();
   }
 
@@ -388,6 +392,8 @@ Int unittest (const mpi::Parallel::Ptr& p) {
       for (const bool external_memory : {false, true})
         nerr += TestCAAS(p, ncells, own_reducer, external_memory, false)
           .run<TestCAAS::CAAST>(1, false);
+    nerr += TestCAAS(p, ncells, false, false, false, true)
+      .run<TestCAAS::CAAST>(1, false);
   }
   return nerr;
 }
@@ -48,8 +48,12 @@ public:
     virtual int n_accum_in_place () const { return 1; }
   };
 
+  // If node_aware_all_reduce, and no UserAllReducer is provided, the global
+  // reduction first reduces within each shared-memory node, then among one
+  // leader per node. See mpi::all_reduce(const NodeTopology&, ...).
   CAAS(const mpi::Parallel::Ptr& p, const Int nlclcells,
-       const typename UserAllReducer::Ptr& r = nullptr);
+       const typename UserAllReducer::Ptr& r = nullptr,
+       const bool node_aware_all_reduce = false);
 
   void declare_tracer(int problem_type, const Int& rhomidx) override;
 
@@ -100,6 +104,7 @@ protected:
 
   mpi::Parallel::Ptr p_;
   typename UserAllReducer::Ptr user_reducer_;
+  mpi::NodeTopology::ConstPtr node_topo_;
   std::shared_ptr<std::vector<Decl> > tracer_decls_;
   typename IntList::HostMirror probs_h_;
   IntList t2r_;
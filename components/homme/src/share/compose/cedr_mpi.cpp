@@ -83,5 +83,45 @@ bool all_ok (const Parallel& p, bool im_ok) {
   return static_cast<bool>(msg);
 }
 
+NodeTopology::NodeTopology (const Parallel& p) {
+  MPI_Comm_split_type(p.comm(), MPI_COMM_TYPE_SHARED, p.rank(), MPI_INFO_NULL,
+                      &node);
+  int node_rank;
+  MPI_Comm_rank(node, &node_rank);
+  MPI_Comm_split(p.comm(), node_rank == 0 ? 0 : MPI_UNDEFINED, p.rank(),
+                 &leaders);
+  int idx = -1, n = 0;
+  if (amleader()) {
+    MPI_Comm_rank(leaders, &idx);
+    MPI_Comm_size(leaders, &n);
+  }
+  int buf[2] = {idx, n};
+  MPI_Bcast(buf, 2, MPI_INT, 0, node);
+  node_idx = buf[0];
+  nnode = buf[1];
+  rank2node.resize(p.size());
+  MPI_Allgather(&node_idx, 1, get_type<Int>(), rank2node.data(), 1,
+                get_type<Int>(), p.comm());
+}
+
+NodeTopology::~NodeTopology () {
+  int fin;
+  MPI_Finalized(&fin);
+  if (fin) return;
+  if (leaders != MPI_COMM_NULL) MPI_Comm_free(&leaders);
+  MPI_Comm_free(&node);
+}
+
+bool NodeTopology::nodes_are_contiguous () const {
+  // Each node index appears in one contiguous range of ranks.
+  std::vector<bool> seen(nnode, false);
+  for (size_t r = 0; r < rank2node.size(); ++r) {
+    if (r > 0 && rank2node[r] == rank2node[r-1]) continue;
+    if (seen[rank2node[r]]) return false;
+    seen[rank2node[r]] = true;
+  }
+  return true;
+}
+
 } // namespace mpi
 } // namespace cedr
@@ -5,6 +5,7 @@
 #define INCLUDE_CEDR_MPI_HPP
 
 #include <memory>
+#include <vector>
 
 #include <mpi.h>
 
@@ -69,6 +70,41 @@ int gatherv(const Parallel& p, const T* sendbuf, int sendcount,
 
 bool all_ok(const Parallel& p, bool im_ok);
 
+// The shared-memory node structure of a communicator. node is the communicator
+// of the ranks on this rank's node (MPI_Comm_split_type with
+// MPI_COMM_TYPE_SHARED); leaders is the communicator of rank 0 of each node,
+// and is MPI_COMM_NULL on other ranks. Nodes are numbered by their leader's
+// rank in leaders.
+struct NodeTopology {
+  typedef std::shared_ptr<const NodeTopology> ConstPtr;
+
+  NodeTopology(const Parallel& p);
+  ~NodeTopology();
+
+  // The communicators are freed in the destructor, so don't copy them.
+  NodeTopology(const NodeTopology&) = delete;
+  NodeTopology& operator=(const NodeTopology&) = delete;
+
+  MPI_Comm node, leaders;
+  Int node_idx, nnode;
+  // rank2node[r] is the node index of rank r in p.
+  std::vector<Int> rank2node;
+
+  bool amleader () const { return leaders != MPI_COMM_NULL; }
+
+  // True if the ranks of each node are contiguous in p, e.g., with block rank
+  // placement.
+  bool nodes_are_contiguous() const;
+};
+
+// All-reduce in three steps: reduce onto each node's leader, all-reduce among
+// the leaders, and broadcast within each node. The inter-node step has one
+// participant per node rather than one per rank. The result is not BFB with
+// all_reduce, since the order of the reduction differs.
+template <typename T>
+int all_reduce(const NodeTopology& nt, const T* sendbuf, T* rcvbuf, int count,
+               MPI_Op op);
+
 struct Op {
   typedef std::shared_ptr<Op> Ptr;
 
@@ -20,6 +20,19 @@ int all_reduce (const Parallel& p, const T* sendbuf, T* rcvbuf, int count, MPI_O
   return MPI_Allreduce(const_cast<T*>(sendbuf), rcvbuf, count, dt, op, p.comm());
 }
 
+template <typename T>
+int all_reduce (const NodeTopology& nt, const T* sendbuf, T* rcvbuf, int count,
+                MPI_Op op) {
+  MPI_Datatype dt = get_type<T>();
+  int err = MPI_Reduce(const_cast<T*>(sendbuf), rcvbuf, count, dt, op, 0, nt.node);
+  if (err != MPI_SUCCESS) return err;
+  if (nt.amleader()) {
+    err = MPI_Allreduce(MPI_IN_PLACE, rcvbuf, count, dt, op, nt.leaders);
+    if (err != MPI_SUCCESS) return err;
+  }
+  return MPI_Bcast(rcvbuf, count, dt, 0, nt.node);
+}
+
 template <typename T>
 int isend (const Parallel& p, const T* buf, int count, int dest, int tag,
            Request* ireq) {
@@ -70,6 +70,18 @@ typedef Kokkos::Experimental::SYCL ComposeGpuSpace;
 # endif
 #endif
 
+// If defined, the q interpolation at a departure point forms the 16
+// tensor-product weights once -- divided by dp when interpolating qdp/dp -- and
+// applies them to all tracers as a dot product. This removes the per-tracer
+// divisions, but it is not BFB with the default separable evaluation.
+//#define COMPOSE_Q_PRECOMPUTE_WEIGHTS
+
+// If defined, the QLT tree is first split along shared-memory node boundaries,
+// so that all tree levels below a node's subtree communicate within the node.
+// The tree then depends on rank placement, so the result is no longer BFB
+// across decompositions.
+//#define COMPOSE_NODE_AWARE_TREE
+
 #if defined COMPOSE_BOUNDS_CHECK && defined NDEBUG
 # pragma message "NDEBUG but COMPOSE_BOUNDS_CHECK"
 #endif
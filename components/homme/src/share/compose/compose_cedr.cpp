@@ -117,6 +117,27 @@ private:
 };
 } // namespace oned
 
+void set_kids (const tree::Node::Ptr& n, const tree::Node::Ptr& k1,
+               const tree::Node::Ptr& k2, const Int my_rank) {
+  n->level = 1 + std::max(k1->level, k2->level);
+  if (n->rank == my_rank) {
+    // Need to know both kids for comm.
+    n->nkids = 2;
+    n->kids[0] = k1;
+    n->kids[1] = k2;
+  } else {
+    // Prune parts of the tree irrelevant to my rank.
+    n->nkids = 0;
+    if (k1->nkids > 0 || k1->rank == my_rank) n->kids[n->nkids++] = k1;
+    if (k2->nkids > 0 || k2->rank == my_rank) n->kids[n->nkids++] = k2;
+    if (n->nkids == 0) {
+      // Signal a non-leaf node with 0 kids to init_tree.
+      n->nkids = -1;
+    }
+  }
+  cedr_assert(n->level > 0 || n->nkids == 0);
+}
+
 // This impl carefully follows the requirements that
 // cedr::qlt::impl::init_tree, level_schedule_and_collect
 // establish. init_tree has to be modified to have the condition in
@@ -143,23 +164,7 @@ make_my_tree_part (const oned::Mesh& m, const Int cs, const Int ce,
   }
   const auto k1 = make_my_tree_part(m, cs, cs + cn0, n.get(), nrank, rank2sfc);
   const auto k2 = make_my_tree_part(m, cs + cn0, ce, n.get(), nrank, rank2sfc);
-  n->level = 1 + std::max(k1->level, k2->level);
-  if (n->rank == my_rank) {
-    // Need to know both kids for comm.
-    n->nkids = 2;
-    n->kids[0] = k1;
-    n->kids[1] = k2;
-  } else {
-    // Prune parts of the tree irrelevant to my rank.
-    n->nkids = 0;
-    if (k1->nkids > 0 || k1->rank == my_rank) n->kids[n->nkids++] = k1;
-    if (k2->nkids > 0 || k2->rank == my_rank) n->kids[n->nkids++] = k2;
-    if (n->nkids == 0) {
-      // Signal a non-leaf node with 0 kids to init_tree.
-      n->nkids = -1;
-    }
-  }
-  cedr_assert(n->level > 0 || n->nkids == 0);
+  set_kids(n, k1, k2, my_rank);
   return n;
 }
 
@@ -170,6 +175,30 @@ make_my_tree_part (const cedr::mpi::Parallel::Ptr& p, const Int& ncells,
   return make_my_tree_part(m, 0, m.ncell(), nullptr, nrank, rank2sfc);
 }
 
+// Same as make_my_tree_part, but the top of the tree is over the node index
+// range [ns, ne), and each node's SFC range [node2sfc[i], node2sfc[i+1]) gets
+// its own subtree. This requires each node's ranks to be contiguous.
+tree::Node::Ptr
+make_my_tree_part (const oned::Mesh& m, const Int ns, const Int ne,
+                   const tree::Node* parent, const Int& nrank,
+                   const Int* rank2sfc, const std::vector<Int>& node2sfc) {
+  if (ne - ns == 1)
+    return make_my_tree_part(m, node2sfc[ns], node2sfc[ne], parent, nrank,
+                             rank2sfc);
+  const auto my_rank = m.parallel()->rank();
+  const Int nn0 = (ne - ns)/2;
+  tree::Node::Ptr n = std::make_shared<tree::Node>();
+  n->parent = parent;
+  n->rank = rank2sfc_search(rank2sfc, nrank, node2sfc[ns]);
+  n->cellidx = n->rank == my_rank ? node2sfc[ns] : -1;
+  const auto k1 = make_my_tree_part(m, ns, ns + nn0, n.get(), nrank, rank2sfc,
+                                    node2sfc);
+  const auto k2 = make_my_tree_part(m, ns + nn0, ne, n.get(), nrank, rank2sfc,
+                                    node2sfc);
+  set_kids(n, k1, k2, my_rank);
+  return n;
+}
+
 static size_t nextpow2 (size_t n) {
   size_t p = 1;
   while (p < n) p <<= 1;
@@ -190,7 +219,20 @@ tree::Node::Ptr
 make_tree_sgi (const cedr::mpi::Parallel::Ptr& p, const Int nelem,
                const Int* owned_ids, const Int* rank2sfc, const Int nsublev) {
   // Partition 0:nelem-1, the space-filling curve space.
-  auto tree = make_my_tree_part(p, nelem, p->size(), rank2sfc);
+  tree::Node::Ptr tree;
+#ifdef COMPOSE_NODE_AWARE_TREE
+  const cedr::mpi::NodeTopology nt(*p);
+  if (nt.nnode > 1 && nt.nodes_are_contiguous()) {
+    std::vector<Int> node2sfc(nt.nnode + 1);
+    for (Int r = p->size() - 1; r >= 0; --r)
+      node2sfc[nt.rank2node[r]] = rank2sfc[r];
+    node2sfc[nt.nnode] = nelem;
+    oned::Mesh m(nelem, p);
+    tree = make_my_tree_part(m, 0, nt.nnode, nullptr, p->size(), rank2sfc,
+                             node2sfc);
+  }
+#endif
+  if ( ! tree) tree = make_my_tree_part(p, nelem, p->size(), rank2sfc);
   // Renumber so that node->cellidx records the global element number, and
   // associate the correct rank with the element.
   const auto my_rank = p->rank();
@@ -185,6 +185,58 @@ SLMM_KIF Real calc_q_tgt (const Real rx[4], const Real ry[4], const Real qdp[16]
                  rx[2]*(qdp[14]/dp[14]) + rx[3]*(qdp[15]/dp[15])));
 }
 
+// Interpolate a tracer from its 16 source GLL values, given the 1D weights at a
+// departure point. The weights are shared by all tracers at that point.
+struct QInterp {
+#ifdef COMPOSE_Q_PRECOMPUTE_WEIGHTS
+  Real wts[16];
+  SLMM_KIF QInterp (const Real rx[4], const Real ry[4]) {
+    for (Int j = 0; j < 4; ++j)
+      for (Int i = 0; i < 4; ++i)
+        wts[4*j + i] = ry[j]*rx[i];
+  }
+  SLMM_KIF Real operator() (const Real qs[16]) const {
+    Real q = 0;
+    for (Int k = 0; k < 16; ++k) q += wts[k]*qs[k];
+    return q;
+  }
+#else
+  Real rx[4], ry[4];
+  SLMM_KIF QInterp (const Real rx_[4], const Real ry_[4]) {
+    for (Int i = 0; i < 4; ++i) { rx[i] = rx_[i]; ry[i] = ry_[i]; }
+  }
+  SLMM_KIF Real operator() (const Real qs[16]) const {
+    return calc_q_tgt(rx, ry, qs);
+  }
+#endif
+};
+
+// Same as QInterp, but interpolate q = qdp/dp. dp is the same for all tracers.
+struct QdpInterp {
+#ifdef COMPOSE_Q_PRECOMPUTE_WEIGHTS
+  Real wts[16];
+  SLMM_KIF QdpInterp (const Real rx[4], const Real ry[4], const Real dp[16]) {
+    for (Int j = 0; j < 4; ++j)
+      for (Int i = 0; i < 4; ++i)
+        wts[4*j + i] = ry[j]*rx[i]/dp[4*j + i];
+  }
+  SLMM_KIF Real operator() (const Real qdp[16]) const {
+    Real q = 0;
+    for (Int k = 0; k < 16; ++k) q += wts[k]*qdp[k];
+    return q;
+  }
+#else
+  Real rx[4], ry[4], dp[16];
+  SLMM_KIF QdpInterp (const Real rx_[4], const Real ry_[4], const Real dp_[16]) {
+    for (Int i = 0; i < 4; ++i) { rx[i] = rx_[i]; ry[i] = ry_[i]; }
+    for (Int k = 0; k < 16; ++k) dp[k] = dp_[k];
+  }
+  SLMM_KIF Real operator() (const Real qdp[16]) const {
+    return calc_q_tgt(rx, ry, qdp, dp);
+  }
+#endif
+};
+
 template <typename Buffer> SLMM_KIF
 Int getbuf (Buffer& buf, const Int& os, Int& i1, Int& i2) {
   const Int* const b = reinterpret_cast<const Int*>(&buf(os));
@@ -218,20 +270,21 @@ void calc_q (const IslMpi<MT>& cm, const Int& src_lid, const Int& lev,
   if (use_q) {
     // We can use q from calc_q_extrema.
     const Real* const qs0 = ed.q + levos;
+    const QInterp interp(rx, ry);
     // Block for auto-vectorization.
     for (Int iqo = 0; iqo < qsize; iqo += blocksize) {
       if (iqo + blocksize <= qsize) {
         Real tmp[blocksize];
         for (Int iqi = 0; iqi < blocksize; ++iqi) {
           const Real* const qs = qs0 + (iqo + iqi)*np2nlev;
-          tmp[iqi] = calc_q_tgt(rx, ry, qs);
+          tmp[iqi] = interp(qs);
         }
         for (Int iqi = 0; iqi < blocksize; ++iqi)
           q_tgt[iqo + iqi] = tmp[iqi];
       } else {
         for (Int iq = iqo; iq < qsize; ++iq) {
           const Real* const qs = qs0 + iq*np2nlev;
-          q_tgt[iq] = calc_q_tgt(rx, ry, qs);
+          q_tgt[iq] = interp(qs);
         }
       }
     }
@@ -239,19 +292,20 @@ void calc_q (const IslMpi<MT>& cm, const Int& src_lid, const Int& lev,
     // q from calc_q_extrema is being overwritten, so have to use qdp/dp.
     const Real* const dp = ed.dp + levos;
     const Real* const qdp0 = ed.qdp + levos;
+    const QdpInterp interp(rx, ry, dp);
     for (Int iqo = 0; iqo < qsize; iqo += blocksize) {
       if (iqo + blocksize <= qsize) {
         Real tmp[blocksize];
         for (Int iqi = 0; iqi < blocksize; ++iqi) {
           const Real* const qdp = qdp0 + (iqo + iqi)*np2nlev;
-          tmp[iqi] = calc_q_tgt(rx, ry, qdp, dp);
+          tmp[iqi] = interp(qdp);
         }
         for (Int iqi = 0; iqi < blocksize; ++iqi)
           q_tgt[iqo + iqi] = tmp[iqi];
       } else {
         for (Int iq = iqo; iq < qsize; ++iq) {
           const Real* const qdp = qdp0 + iq*np2nlev;
-          q_tgt[iq] = calc_q_tgt(rx, ry, qdp, dp);
+          q_tgt[iq] = interp(qdp);
         }
       }
     }
@@ -391,6 +445,7 @@ void calc_own_q (IslMpi<MT>& cm, const Int& nets, const Int& nete,
     // q from calc_q_extrema is being overwritten, so have to use qdp/dp.
     Real dp[16];
     for (Int k = 0; k < 16; ++k) dp[k] = dp_src(slid, k, tgt_lev);
+    const QdpInterp interp(rx, ry, dp);
     // Block for auto-vectorization.
     for (Int iqo = 0; iqo < qsize; iqo += blocksize) {
       if (iqo + blocksize <= qsize) {
@@ -399,7 +454,7 @@ void calc_own_q (IslMpi<MT>& cm, const Int& nets, const Int& nete,
           const Int iq = iqo + iqi;
           Real qdp[16];
           for (Int k = 0; k < 16; ++k) qdp[k] = qdp_src(slid, qtl, iq, k, tgt_lev);
-          tmp[iqi] = calc_q_tgt(rx, ry, qdp, dp);
+          tmp[iqi] = interp(qdp);
         }
         for (Int iqi = 0; iqi < blocksize; ++iqi)
           q_tgt(tci, iqo + iqi, tgt_k, tgt_lev) = tmp[iqi];
@@ -407,7 +462,7 @@ void calc_own_q (IslMpi<MT>& cm, const Int& nets, const Int& nete,
         for (Int iq = iqo; iq < qsize; ++iq) {
           Real qdp[16];
           for (Int k = 0; k < 16; ++k) qdp[k] = qdp_src(slid, qtl, iq, k, tgt_lev);
-          q_tgt(tci, iq, tgt_k, tgt_lev) = calc_q_tgt(rx, ry, qdp, dp);
+          q_tgt(tci, iq, tgt_k, tgt_lev) = interp(qdp);
         }
       }
     }
@@ -566,6 +621,7 @@ void calc_rmt_q_pass2 (IslMpi<MT>& cm) {
     Real rx[4], ry[4];
     calc_coefs<np,MT>(s2r, local_meshes(lid), alg, lid, lev, &xs(xos), rx, ry);
     Real* const q_tgt = &qs(qos);
+    const QInterp interp(rx, ry);
     // Block for auto-vectorization.
     for (Int iqo = 0; iqo < qsize; iqo += blocksize) {
       if (iqo + blocksize <= qsize) {
@@ -574,7 +630,7 @@ void calc_rmt_q_pass2 (IslMpi<MT>& cm) {
           const Int iq = iqo + iqi;
           Real qsrc[16];
           for (Int k = 0; k < 16; ++k) qsrc[k] = q_src(lid, iq, k, lev);
-          tmp[iqi] = calc_q_tgt(rx, ry, qsrc);
+          tmp[iqi] = interp(qsrc);
         }
         for (Int iqi = 0; iqi < blocksize; ++iqi)
           q_tgt[iqo + iqi] = tmp[iqi];
@@ -582,7 +638,7 @@ void calc_rmt_q_pass2 (IslMpi<MT>& cm) {
         for (Int iq = iqo; iq < qsize; ++iq) {
           Real qsrc[16];
           for (Int k = 0; k < 16; ++k) qsrc[k] = q_src(lid, iq, k, lev);
-          q_tgt[iq] = calc_q_tgt(rx, ry, qsrc);
+          q_tgt[iq] = interp(qsrc);
         }
       }
     }
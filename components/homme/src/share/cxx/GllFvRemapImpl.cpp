@@ -317,6 +317,58 @@ g2f_mixing_ratio (const KernelVariables& kv, const int np2, const int nf2, const
   g::loop_ik(ttrf, tvr, [&] (int i, int k) { qf(i,iqf,k) = w2(i,k); });
 }
 
+// Remap all nq mixing ratios of an element conservatively and preventing new
+// extrema. This is g2f_mixing_ratio batched over tracers: the GLL->FV operator
+// is applied to all (tracer, level) columns as one small matrix-matrix product,
+// and then CAAS runs on each (tracer, level pack) in parallel. The result is
+// BFB with g2f_mixing_ratio. qg is indexed as (q,dof,level) and qf as
+// (dof,q,level); wc is workspace for nf2 x nlev.
+template <typename RT, typename GS, typename GT, typename DS, typename DT,
+          typename QS, typename WT, typename QT>
+static KOKKOS_FUNCTION void
+g2f_mixing_ratios (const KernelVariables& kv, const int np2, const int nf2, const int nlev,
+                   const int nq, const RT& g2f_remap, const GS& geog, const Real sf,
+                   const GT& geof, const DS& dpg, const DT& dpf, const QS& qg,
+                   const WT& wc, const QT& qf) {
+  using g = GllFvRemapImpl;
+  using Kokkos::parallel_for;
+  const int packn = GllFvRemapImpl::packn;
+  const auto ttrf  = Kokkos::TeamThreadRange(kv.team, nf2);
+  const auto ttrfq = Kokkos::TeamThreadRange(kv.team, nf2*nq);
+  const auto tvr   = Kokkos::ThreadVectorRange(kv.team, nlev);
+
+  // Linearly remap qdp GLL->FV for all tracers, and compute the CAAS weights,
+  // which are the same for all tracers.
+  parallel_for(ttrfq, [&] (const int idx) {
+    const int i = idx / nq, iq = idx % nq;
+    parallel_for(tvr, [&] (const int k) {
+      Scalar y(0);
+      for (int j = 0; j < np2; ++j)
+        y += g2f_remap(i,j) * ((dpg(j,k)*qg(iq,j,k)) * geog(j));
+      y /= sf * geof(i);
+      qf(i,iq,k) = y / dpf(i,k);
+    }); });
+  g::loop_ik(ttrf, tvr, [&] (int i, int k) { wc(i,k) = (sf*geof(i))*dpf(i,k); });
+  kv.team_barrier();
+
+  // Apply CAAS with bounds from the GLL values in each (tracer, level pack).
+  g::team_parallel_for_with_linear_index(
+    kv.team, nq*nlev,
+    [&] (const int idx) {
+      const int iq = idx / nlev, k = idx % nlev;
+      Scalar qmin = qg(iq,0,k), qmax = qmin;
+      for (int i = 1; i < np2; ++i) {
+        const auto qik = qg(iq,i,k);
+        VECTOR_SIMD_LOOP for (int s = 0; s < packn; ++s)
+          qmin[s] = min(qmin[s], qik[s]);
+        VECTOR_SIMD_LOOP for (int s = 0; s < packn; ++s)
+          qmax[s] = max(qmax[s], qik[s]);
+      }
+      g::limiter_clip_and_sum_level(nf2, k, wc, qmin, qmax,
+                                    Kokkos::subview(qf, Kokkos::ALL(), iq, Kokkos::ALL()));
+    });
+}
+
 template <typename RT, typename GS, typename GT, typename DS, typename DT, typename WT,
           typename QFT, typename QGT>
 static KOKKOS_FUNCTION void
@@ -532,28 +584,27 @@ void GllFvRemapImpl
   Kokkos::parallel_for(m_tp_ne, fe);
 
   const auto dp_g = m_state.m_dp3d;
-  const auto tu_ne_qsize = m_tu_ne_qsize;
   const auto feq = KOKKOS_LAMBDA (const MT& team) {
-    KernelVariables kv(team, qsize, tu_ne_qsize);
-    const auto ie = kv.ie, iq = kv.iq;
+    KernelVariables kv(team, tu_ne);
+    const auto ie = kv.ie;
 
     const auto all = Kokkos::ALL();
     const auto rw1 = Kokkos::subview(buf10, kv.team_idx, all, all, all);
-    const auto rw2 = Kokkos::subview(buf11, kv.team_idx, all, all, all);
 
     const evucr1 fv_metdet_ie(&fv_metdet(ie,0), nf2),
       gll_metdet_ie(&gll_metdet(ie,0,0), np2);
     const EVU<const Scalar**> dp_fv_ie(&dp_fv(ie,0,0,0), nf2, nlevpk);
     
-    // q
-    g2f_mixing_ratio(
-      kv, np2, nf2, nlevpk, g2f_remapd, gll_metdet_ie, w_ff, fv_metdet_ie,
-      evucs_np2_nlev(&dp_g(ie,timeidx,0,0,0)), dp_fv_ie, evucs_np2_nlev(&q_g(ie,iq,0,0,0)),
-      evus_np2_nlev(rw1.data()), evus_np2_nlev(rw2.data()), iq,
+    // q, all tracers at once
+    g2f_mixing_ratios(
+      kv, np2, nf2, nlevpk, qsize, g2f_remapd, gll_metdet_ie, w_ff, fv_metdet_ie,
+      evucs_np2_nlev(&dp_g(ie,timeidx,0,0,0)), dp_fv_ie,
+      evucs3(&q_g(ie,0,0,0,0), q_g.extent_int(1), np2, nlevpk),
+      evus2(rw1.data(), nf2, nlevpk),
       evus3(&q(ie,0,0,0), q.extent_int(1), q.extent_int(2), q.extent_int(3)));
   };
   Kokkos::fence();
-  Kokkos::parallel_for(m_tp_ne_qsize, feq);
+  Kokkos::parallel_for(m_tp_ne, feq);
 #endif
 }
 
@@ -820,7 +871,6 @@ void GllFvRemapImpl
   const auto qsize = m_data.qsize;
 
   const auto buf10 = m_data.buf1[0];
-  const auto buf11 = m_data.buf1[1];
 
   Errors::runtime_check(nq <= qsize,
                         "GllFvRemap::remap_tracer_dyn_to_fv_phys: nq must be <= qsize.");
@@ -877,30 +927,28 @@ void GllFvRemapImpl
   Kokkos::fence();
   Kokkos::parallel_for(m_tp_ne, fe);
 
-  // q
+  // q, all tracers at once
   const auto dp_g = m_state.m_dp3d;
-  const auto tp_ne_nq = Homme::get_default_team_policy<ExecSpace>(m_data.nelemd * nq);
-  const auto tu_ne_nq = TeamUtils<ExecSpace>(tp_ne_nq);
   const auto feq = KOKKOS_LAMBDA (const MT& team) {
-    KernelVariables kv(team, nq, tu_ne_nq);
-    const auto ie = kv.ie, iq = kv.iq;
+    KernelVariables kv(team, tu_ne);
+    const auto ie = kv.ie;
 
     const auto all = Kokkos::ALL();
     const auto rw1 = Kokkos::subview(buf10, kv.team_idx, all, all, all);
-    const auto rw2 = Kokkos::subview(buf11, kv.team_idx, all, all, all);
 
     const evucr1 fv_metdet_ie(&fv_metdet(ie,0), nf2),
       gll_metdet_ie(&gll_metdet(ie,0,0), np2);
     const EVU<const Scalar**> dp_fv_ie(&dp_fv(ie,0,0,0), nf2, nlevpk);
     
-    g2f_mixing_ratio(
-      kv, np2, nf2, nlevpk, g2f_remapd, gll_metdet_ie, w_ff, fv_metdet_ie,
-      evucs_np2_nlev(&dp_g(ie,timeidx,0,0,0)), dp_fv_ie, evucs_np2_nlev(&q_dyn(ie,iq,0,0)),
-      evus_np2_nlev(rw1.data()), evus_np2_nlev(rw2.data()), iq,
+    g2f_mixing_ratios(
+      kv, np2, nf2, nlevpk, nq, g2f_remapd, gll_metdet_ie, w_ff, fv_metdet_ie,
+      evucs_np2_nlev(&dp_g(ie,timeidx,0,0,0)), dp_fv_ie,
+      evucs3(&q_dyn(ie,0,0,0), q_dyn.extent_int(1), q_dyn.extent_int(2), q_dyn.extent_int(3)),
+      evus2(rw1.data(), nf2, nlevpk),
       evus3(&q_fv(ie,0,0,0), q_fv.extent_int(1), q_fv.extent_int(2), q_fv.extent_int(3)));
   };
   Kokkos::fence();
-  Kokkos::parallel_for(tp_ne_nq, feq);
+  Kokkos::parallel_for(m_tp_ne, feq);
 #endif  
 }
 
@@ -263,64 +263,73 @@ struct GllFvRemapImpl {
     assert(q  .extent_int(0) >= n && q  .extent_int(1) >= nlev);
     static_assert(Scalar::vector_length == packn, "vector_length == packn");
     const auto f = [&] (const int k) {
-      auto& c = wrk;
-      { // In the case of an infeasible problem, prefer to conserve mass and
-        // violate a bound.
-        Scalar mass(0), qmass(0);
-        for (int i = 0; i < n; ++i) {
-          c(i,k) = (s*geo(i))*dp(i,k);
-          mass  += c(i,k);
-          qmass += c(i,k)*q(i,k);
+      for (int i = 0; i < n; ++i)
+        wrk(i,k) = (s*geo(i))*dp(i,k);
+      limiter_clip_and_sum_level(n, k, wrk, qmin(k), qmax(k), q);
+    };
+    team_parallel_for_with_linear_index(team, nlev, f);
+  }
+
+  /* The body of limiter_clip_and_sum for level pack k. c(i,k) = s geo(i)
+     dp(i,k) must already be computed. qmin, qmax are modified if the problem
+     is infeasible.
+   */
+  template <typename CV2, typename VQ>
+  static KOKKOS_INLINE_FUNCTION void
+  limiter_clip_and_sum_level (const int n, const int k, const CV2& c,
+                              Scalar& qmin, Scalar& qmax, const VQ& q) {
+    { // In the case of an infeasible problem, prefer to conserve mass and
+      // violate a bound.
+      Scalar mass(0), qmass(0);
+      for (int i = 0; i < n; ++i) {
+        mass  += c(i,k);
+        qmass += c(i,k)*q(i,k);
+      }
+      VECTOR_SIMD_LOOP for (int s = 0; s < packn; ++s)
+        if (qmass[s] < qmin[s]*mass[s])
+          qmin[s] = qmass[s]/mass[s];
+      VECTOR_SIMD_LOOP for (int s = 0; s < packn; ++s)
+        if (qmass[s] > qmax[s]*mass[s])
+          qmax[s] = qmass[s]/mass[s];
+    }
+
+    Scalar addmass(0);
+    bool modified[packn] = {0};
+    // Clip.
+    for (int i = 0; i < n; ++i)
+      VECTOR_SIMD_LOOP for (int s = 0; s < packn; ++s) {
+        auto& x = q(i,k)[s];
+        const auto xmin = qmin[s];
+        const auto xmax = qmax[s];
+        if (x > xmax) {
+          modified[s] = true;
+          addmass[s] += (x - xmax)*c(i,k)[s];
+          x = xmax;
+        } else if (x < xmin) {
+          modified[s] = true;
+          addmass[s] += (x - xmin)*c(i,k)[s];
+          x = xmin;
         }
-        VECTOR_SIMD_LOOP for (int s = 0; s < packn; ++s)
-          if (qmass[s] < qmin(k)[s]*mass[s])
-            qmin(k)[s] = qmass[s]/mass[s];
-        VECTOR_SIMD_LOOP for (int s = 0; s < packn; ++s)
-          if (qmass[s] > qmax(k)[s]*mass[s])
-            qmax(k)[s] = qmass[s]/mass[s];
       }
 
-      Scalar addmass(0);
-      bool modified[packn] = {0};
-      // Clip.
-      for (int i = 0; i < n; ++i)
-        VECTOR_SIMD_LOOP for (int s = 0; s < packn; ++s) {
+    // Compute weights normalization.
+    Scalar den(0);
+    for (int i = 0; i < n; ++i)
+      VECTOR_SIMD_LOOP for (int s = 0; s < packn; ++s)
+        if (modified[s]) {
+          if (addmass[s] > 0)
+            den[s] += (qmax[s] - q(i,k)[s])*c(i,k)[s];
+          else
+            den[s] += (q(i,k)[s] - qmin[s])*c(i,k)[s];
+        }
+    // Redistribute mass.
+    for (int i = 0; i < n; ++i)
+      VECTOR_SIMD_LOOP for (int s = 0; s < packn; ++s)
+        if (modified[s] && den[s] > 0) {
           auto& x = q(i,k)[s];
-          const auto xmin = qmin(k)[s];
-          const auto xmax = qmax(k)[s];
-          if (x > xmax) {
-            modified[s] = true;
-            addmass[s] += (x - xmax)*c(i,k)[s];
-            x = xmax;
-          } else if (x < xmin) {
-            modified[s] = true;
-            addmass[s] += (x - xmin)*c(i,k)[s];
-            x = xmin;
-          }
+          const auto v = addmass[s] > 0 ? qmax[s] - x : x - qmin[s];
+          x += addmass[s]*(v/den[s]);
         }
-
-      {
-        // Compute weights normalization.
-        Scalar den(0);
-        for (int i = 0; i < n; ++i)
-          VECTOR_SIMD_LOOP for (int s = 0; s < packn; ++s)
-            if (modified[s]) {
-              if (addmass[s] > 0)
-                den[s] += (qmax(k)[s] - q(i,k)[s])*c(i,k)[s];
-              else
-                den[s] += (q(i,k)[s] - qmin(k)[s])*c(i,k)[s];
-            }
-        // Redistribute mass.
-        for (int i = 0; i < n; ++i)
-          VECTOR_SIMD_LOOP for (int s = 0; s < packn; ++s)
-            if (modified[s] && den[s] > 0) {
-              auto& x = q(i,k)[s];
-              const auto v = addmass[s] > 0 ? qmax(k)[s] - x : x - qmin(k)[s];
-              x += addmass[s]*(v/den[s]);
-            }
-      }
-    };
-    team_parallel_for_with_linear_index(team, nlev, f);
   }
 
   template <typename CR1, typename VW, typename VQ>
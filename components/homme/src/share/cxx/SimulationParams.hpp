@@ -62,6 +62,10 @@ struct SimulationParams
   double    laplacian_rigid_factor; // propagated to SphereOps
   bool      pgrad_correction;
 
+  // Non-BFB: retire each column from the DIRK Newton iteration as soon as it
+  // converges. Only for theta model, and ignored by the BFB solver.
+  bool      dirk_column_early_exit = false;
+
   double    dp3d_thresh;
   double    vtheta_thresh;
 
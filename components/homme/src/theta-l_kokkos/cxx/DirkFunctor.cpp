@@ -34,6 +34,10 @@ void DirkFunctor::init_buffers (const FunctorsBuffersManager& fbm) {
   m_dirk_impl->init_buffers(fbm);
 }
 
+void DirkFunctor::set_column_early_exit (const bool col_early_exit) {
+  m_dirk_impl->m_col_early_exit = col_early_exit;
+}
+
 void DirkFunctor::run (int nm1, Real alphadt_nm1, int n0, Real alphadt_n0, int np1, Real dt2,
                        const Elements& elements, const HybridVCoord& hvcoord) {
   GPTLstart("compute_stage_value_dirk");
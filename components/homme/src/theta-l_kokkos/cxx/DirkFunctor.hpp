@@ -28,6 +28,11 @@ public:
   int requested_buffer_size() const;
   void init_buffers(const FunctorsBuffersManager& fbm);
 
+  // Non-BFB option: retire each column from the Newton iteration as soon as it
+  // converges rather than iterating until all columns in an element converge.
+  // Off by default; set from the dirk_column_early_exit namelist option.
+  void set_column_early_exit(const bool col_early_exit);
+
   // Top-level interface, equivalent to compute_stage_value_dirk.
   void run(int nm1, Real alphadt_nm1, int n0, Real alphadt_n0, int np1, Real dt2,
            const Elements& elements, const HybridVCoord& hvcoord);
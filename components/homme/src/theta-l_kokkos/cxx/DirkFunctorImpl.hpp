@@ -30,7 +30,7 @@ struct DirkFunctorImpl {
   enum : int { max_num_lev_pack = NUM_LEV_P };
   enum : int { num_lev_aligned = max_num_lev_pack*packn };
   enum : int { num_phys_lev = NUM_PHYSICAL_LEV };
-  enum : int { num_work = 12 };
+  enum : int { num_work = 13 };
   enum : bool { calc_initial_guess_in_newton_kernel = false };
 
   enum : int {
@@ -44,6 +44,12 @@ struct DirkFunctorImpl {
   static_assert(num_lev_aligned >= 3,
                 "We use wrk(0:2,:) and so need num_lev_aligned >= 3");
 
+  // Rows of the column-map work slot used by the column-early-exit Newton
+  // mode. See mark_converged_columns.
+  enum : int { cm_col = 0, cm_active = 1, cm_src = 2, cm_err = 3, cm_info = 4 };
+  static_assert(num_lev_aligned > cm_info + 1,
+                "The column map uses rows 0:cm_info+1");
+
   using TeamPolicy = Kokkos::TeamPolicy<ExecSpace>;
   using MT = typename TeamPolicy::member_type;
 
@@ -88,9 +94,14 @@ struct DirkFunctorImpl {
   TeamPolicy m_policy, m_ig_policy;
   TeamUtils<ExecSpace> m_tu, m_tu_ig;
   int nslot;
+  // If true, and if the non-BFB solver is used, the Newton iteration retires
+  // each column as soon as it converges and compacts the remaining columns
+  // into the leading packs. This is not BFB with the standard iteration.
+  bool m_col_early_exit;
 
   DirkFunctorImpl (const int nelem)
     : m_policy(1,1,1), m_ig_policy(1,1,1), m_tu(m_policy), m_tu_ig(m_ig_policy) // throwaway settings
+    , m_col_early_exit(false)
   {
     init(nelem);
   }
@@ -144,7 +155,8 @@ struct DirkFunctorImpl {
       Kokkos::fence();
     }
 
-    run_newton(nm1, alphadt_nm1, n0, alphadt_n0, np1, dt2, e, hvcoord, bfb_solver);
+    run_newton(nm1, alphadt_nm1, n0, alphadt_n0, np1, dt2, e, hvcoord, bfb_solver,
+               m_col_early_exit);
     Kokkos::fence();
   }
 
@@ -200,7 +212,8 @@ struct DirkFunctorImpl {
   }
 
   void run_newton (int nm1, Real alphadt_nm1, int n0, Real alphadt_n0, int np1, Real dt2,
-                   const Elements& e, const HybridVCoord& hvcoord, const bool bfb_solver) {
+                   const Elements& e, const HybridVCoord& hvcoord, const bool bfb_solver,
+                   const bool col_early_exit = false) {
     using Kokkos::subview;
     using Kokkos::parallel_for;
     const auto a = Kokkos::ALL();
@@ -226,6 +239,9 @@ struct DirkFunctorImpl {
     const auto e_initial_guess = e.m_derived.m_divdp_proj;
     const auto hybi = hvcoord.hybrid_bi;
     const auto tu   = m_tu;
+    // Column early exit is a non-BFB optimization, so the BFB solver disables
+    // it.
+    const bool compact = col_early_exit && ! bfb_solver;
 
     const auto toplevel = KOKKOS_LAMBDA (const MT& team, int& nerr) {
       KernelVariables kv(team, tu);
@@ -245,7 +261,8 @@ struct DirkFunctorImpl {
       dp3d      = get_work_slot(work, kv.team_idx,  8),
       pnh       = get_work_slot(work, kv.team_idx,  9),
       wrk       = get_work_slot(work, kv.team_idx, 10),
-      xfull     = get_work_slot(work, kv.team_idx, 11);
+      xfull     = get_work_slot(work, kv.team_idx, 11),
+      colmap    = get_work_slot(work, kv.team_idx, 12);
       const auto
       dl = get_ls_slot(ls, kv.team_idx, 0),
       d  = get_ls_slot(ls, kv.team_idx, 1),
@@ -339,45 +356,89 @@ struct DirkFunctorImpl {
 
       loop_ki(kv, nlev, nvec, [&] (int k, int i) { dphi_n0(k,i) = phi_n0(k+1,i) - phi_n0(k,i); });
 
+      // In the column-early-exit mode, the Newton iteration runs over only the
+      // first ncol_it columns, which occupy the first nvec_it packs. The lanes
+      // of these packs past ncol_it hold copies of an active column (see
+      // compact_columns), so that the EOS, line search and step size never see
+      // stale data; nlane_it counts all of these lanes.
+      int nvec_it = nvec, ncol_it = scaln, nlane_it = scaln;
+      if (compact) {
+        loop_ki(kv, 1, nvec, [&] (int, int i) {
+          for (int s = 0; s < packn; ++s) colmap(cm_col,i)[s] = i*packn + s;
+        });
+        kv.team_barrier();
+      }
+
       int it = 0;
       Real deltaerr;
       for (; it < maxiter; ++it) { // Newton iteration
         const bool ok = pnh_and_exner_from_eos(kv, hvcoord, vtheta_dp, dp3d,
-                                               dphi, pnh, wrk, dpnh_dp_i);
+                                               dphi, pnh, wrk, dpnh_dp_i,
+                                               nlev, nvec_it);
         if ( ! ok) nerr = 1;
         kv.team_barrier();
-        loop_ki(kv, nlev, nvec, [&] (const int k, const int i) {
+        loop_ki(kv, nlev, nvec_it, [&] (const int k, const int i) {
           x(k,i) = -(w_np1(k,i) - (w_n0(k,i) + grav*dt2*(dpnh_dp_i(k,i) - 1))); // -residual
         });
 
-        calc_jacobian(kv, dt2, dp3d, dphi, pnh, dl, d, du);
+        calc_jacobian(kv, dt2, dp3d, dphi, pnh, dl, d, du, nlev, nvec_it);
         kv.team_barrier();
-        if (bfb_solver) solvebfb(kv, dl, d, du, x); else solve(kv, dl, d, du, x);
+        if (bfb_solver) solvebfb(kv, dl, d, du, x);
+        else if (compact) solve_active(kv, nvec_it, dl, d, du, x);
+        else solve(kv, dl, d, du, x);
         kv.team_barrier();
 
-        loop_ki(kv, 1, nvec, [&] (int k, int i) { wrk(2,i) = 1; });
+        loop_ki(kv, 1, nvec_it, [&] (int k, int i) { wrk(2,i) = 1; });
         kv.team_barrier();
         for (int nsafe = 0; nsafe < 2; ++nsafe) {
-          loop_ki(kv, nlev-1, nvec, [&] (int k, int i) {
+          loop_ki(kv, nlev-1, nvec_it, [&] (int k, int i) {
             dphi(k,i) = dphi_n0(k,i) + dt2*grav*(         (w_np1(k+1,i) - w_np1(k,i)) +
                                                  wrk(2,i)*(    x(k+1,i) -     x(k,i)));
           });
-          loop_ki(kv, 1, nvec, [&] (int, int i) {
+          loop_ki(kv, 1, nvec_it, [&] (int, int i) {
             const auto k = nlev-1;
             dphi(k,i) = dphi_n0(k,i) - dt2*grav*(w_np1(k,i) + wrk(2,i)*x(k,i));
           });
           kv.team_barrier();
-          calc_whether_ge(kv, nlev, nvec, 0, dphi, wrk);
+          calc_whether_ge(kv, nlev, nvec_it, 0, dphi, wrk);
           kv.team_barrier();
           if (wrk(1,0)[0] == 0) break;
-          calc_step_size(kv, nlev, nvec, grav, dt2, dphi_n0, w_np1, x, wrk);
+          calc_step_size(kv, nlev, nvec_it, grav, dt2, dphi_n0, w_np1, x, wrk, nlane_it);
           kv.team_barrier();
         }
         kv.team_barrier();
 
-        loop_ki(kv, nlev, nvec, [&] (int k, int i) { w_np1(k,i) += wrk(2,i)*x(k,i); });
+        loop_ki(kv, nlev, nvec_it, [&] (int k, int i) { w_np1(k,i) += wrk(2,i)*x(k,i); });
 
-        if (exit_on_step(kv, nlev, nvec, wmax, deltatol, x, deltaerr)) break;
+        if ( ! compact) {
+          if (exit_on_step(kv, nlev, nvec, wmax, deltatol, x, deltaerr)) break;
+          continue;
+        }
+
+        // Write out the converged columns, then pack the remaining ones into
+        // the leading positions for the next iteration.
+        kv.team_barrier();
+        const int nleft = mark_converged_columns(kv, nlev, ncol_it, wmax, deltatol,
+                                                 x, colmap, deltaerr);
+        retire_columns(kv, nlev, ncol_it, false, dt2, colmap, phi_n0, w_np1,
+                       subview(e_phis,ie,a,a), subview(e_phinh_i,ie,np1,a,a,a),
+                       subview(e_w_i,ie,np1,a,a,a));
+        if (nleft == 0) break;
+        kv.team_barrier();
+        if (nleft < ncol_it) {
+          ncol_it = nleft;
+          nvec_it = (nleft + packn - 1)/packn;
+          nlane_it = nvec_it*packn < scaln ? nvec_it*packn : static_cast<int>(scaln);
+          compact_columns(kv, 1, nleft, nlane_it, colmap, colmap);
+          compact_columns(kv, nlev+1, nleft, nlane_it, colmap, phi_n0);
+          compact_columns(kv, nlev+1, nleft, nlane_it, colmap, w_n0);
+          compact_columns(kv, nlev+1, nleft, nlane_it, colmap, w_np1);
+          compact_columns(kv, nlev+1, nleft, nlane_it, colmap, dphi);
+          compact_columns(kv, nlev+1, nleft, nlane_it, colmap, dphi_n0);
+          compact_columns(kv, nlev+1, nleft, nlane_it, colmap, vtheta_dp);
+          compact_columns(kv, nlev+1, nleft, nlane_it, colmap, dp3d);
+          kv.team_barrier();
+        }
       } // Newton iteration
       kv.team_barrier();
 
@@ -387,6 +448,15 @@ struct DirkFunctorImpl {
         nerr = 1;
       }
 
+      if (compact) {
+        // Columns that converged were already written out.
+        if (it >= maxiter)
+          retire_columns(kv, nlev, ncol_it, true, dt2, colmap, phi_n0, w_np1,
+                         subview(e_phis,ie,a,a), subview(e_phinh_i,ie,np1,a,a,a),
+                         subview(e_w_i,ie,np1,a,a,a));
+        return;
+      }
+
       // Update phi_np1.
       loop_ki(kv, nlev, nvec, [&] (int k, int i) { phi_np1(k,i) = phi_n0(k,i) + dt2*grav*w_np1(k,i); });
 
@@ -561,11 +631,11 @@ struct DirkFunctorImpl {
     const R& vtheta_dp, const R& dp3d, const R& dphi,
     // exner is workspace. dpnh_dp_i(nlevp,:) is not computed.
     const W& pnh, const W& exner, const Wi& dpnh_dp_i,
-    const int nlev = NUM_PHYSICAL_LEV)
+    const int nlev = NUM_PHYSICAL_LEV, const int nvec = npack)
   {
     using Kokkos::parallel_for;
 
-    const int n = npack, ns = packn;
+    const int n = nvec, ns = packn;
     const auto pv = Kokkos::ThreadVectorRange(kv.team, n);
     bool ok = true;
 
@@ -716,10 +786,11 @@ struct DirkFunctorImpl {
                              // All arrays are in DIRK format.
                              const R& dp3d, const R& dphi, const R& pnh,
                              const W& dl, const W& d, const W& du,
-                             const int nlev = NUM_PHYSICAL_LEV) {
+                             const int nlev = NUM_PHYSICAL_LEV,
+                             const int nvec = npack) {
     using Kokkos::parallel_for;
 
-    const int n = npack;
+    const int n = nvec;
     const auto pv = Kokkos::ThreadVectorRange(kv.team, n);
     const auto pt1 = Kokkos::TeamThreadRange(kv.team, 1);
 
@@ -787,6 +858,152 @@ struct DirkFunctorImpl {
     scream::tridiag::bfb(kv.team, dl, d, du, x);
   }
 
+  // Solve the systems in the first nvec packs only. This is used in the
+  // column-early-exit mode, in which the active columns are compacted into the
+  // leading packs.
+  template <typename W>
+  KOKKOS_INLINE_FUNCTION
+  static void solve_active (const KernelVariables& kv, const int nvec,
+                            const W& dl, const W& d, const W& du, const W& x) {
+    assert(d.extent_int(0) == num_phys_lev);
+    if (nvec == npack) {
+      solve(kv, dl, d, du, x);
+      return;
+    }
+    if (OnGpu<ExecSpace>::value) {
+      const auto a = Kokkos::ALL();
+      const auto p = Kokkos::pair<int,int>(0, nvec);
+      scream::tridiag::cr(kv.team, Kokkos::subview(dl,a,p), Kokkos::subview(d,a,p),
+                          Kokkos::subview(du,a,p), Kokkos::subview(x,a,p));
+    } else {
+      // Thomas algorithm, vectorized over the active packs. The pointer-based
+      // scream::tridiag::thomas requires contiguous RHS, so it can't be used
+      // with a pack subrange.
+      const auto f = [&] () {
+        const int nrow = d.extent_int(0);
+        for (int k = 1; k < nrow; ++k)
+          for (int i = 0; i < nvec; ++i) {
+            const auto dlk = dl(k,i)/d(k-1,i);
+            d(k,i) -= dlk*du(k-1,i);
+            x(k,i) -= dlk*x(k-1,i);
+          }
+        for (int i = 0; i < nvec; ++i)
+          x(nrow-1,i) /= d(nrow-1,i);
+        for (int k = nrow-1; k > 0; --k)
+          for (int i = 0; i < nvec; ++i)
+            x(k-1,i) = (x(k-1,i) - du(k-1,i)*x(k,i))/d(k-1,i);
+      };
+      Kokkos::single(Kokkos::PerTeam(kv.team), f);
+    }
+  }
+
+  // Column-early-exit support. Column position p = i*packn + s refers to
+  // entry (k,i)[s] of the DIRK-format work arrays. The column map has these
+  // rows:
+  //   cm_col:    original column index (gi*NP + gj) of position p;
+  //   cm_active: 1 if the column at position p has not converged, else 0;
+  //   cm_src:    for q < nleft, the position of the q'th unconverged column;
+  //   cm_err:    max_k |x(k,p)|, the latest Newton increment of column p;
+  //   cm_info:   cm_info(0)[0] is nleft, cm_info(1)[0] is the max increment
+  //              over all unconverged columns.
+  // Integer data are stored as Real; these are exact for such small values.
+
+  KOKKOS_INLINE_FUNCTION
+  static Real& at (const WorkSlot& w, const int& k, const int& p) {
+    return w(k, p / packn)[p % packn];
+  }
+
+  // Mark each of the first ncol columns as converged or not, and build the
+  // compaction map. Return the number of unconverged columns.
+  KOKKOS_INLINE_FUNCTION
+  static int mark_converged_columns (const KernelVariables& kv, const int nlev,
+                                     const int ncol, const Real& wmax,
+                                     const Real& deltatol, const LinearSystemSlot& x,
+                                     const WorkSlot& colmap, Real& deltaerr) {
+    using Kokkos::parallel_reduce;
+    using Kokkos::TeamThreadRange;
+    using Kokkos::ThreadVectorRange;
+
+    const auto f = [&] (const int p) {
+      const int i = p / packn, s = p % packn;
+      const auto g = [&] (int k, Real& lmaxval) {
+        lmaxval = max(lmaxval, std::abs(x(k,i)[s]));
+      };
+      Real err;
+      parallel_reduce(ThreadVectorRange(kv.team, nlev), g, Kokkos::Max<Real>(err));
+      at(colmap, cm_err, p) = err; // benign write race
+      at(colmap, cm_active, p) = err/wmax < deltatol ? 0 : 1;
+    };
+    Kokkos::parallel_for(TeamThreadRange(kv.team, ncol), f);
+    kv.team_barrier();
+    // ncol <= NP*NP, so building the map serially is cheap.
+    const auto h = [&] () {
+      int nleft = 0;
+      Real errmax = 0;
+      for (int p = 0; p < ncol; ++p) {
+        if (at(colmap, cm_active, p) == 0) continue;
+        errmax = max(errmax, at(colmap, cm_err, p));
+        at(colmap, cm_src, nleft++) = p;
+      }
+      colmap(cm_info,0)[0] = nleft;
+      colmap(cm_info+1,0)[0] = errmax;
+    };
+    Kokkos::single(Kokkos::PerTeam(kv.team), h);
+    kv.team_barrier();
+    deltaerr = colmap(cm_info+1,0)[0];
+    return static_cast<int>(colmap(cm_info,0)[0]);
+  }
+
+  // Write phi_np1 and w_np1 of the first ncol columns that have converged, or
+  // of all of them if all is true, to the element state.
+  template <typename Rphis, typename Wphi, typename Ww>
+  KOKKOS_INLINE_FUNCTION
+  static void retire_columns (const KernelVariables& kv, const int nlev,
+                              const int ncol, const bool all, const Real& dt2,
+                              const WorkSlot& colmap, const WorkSlot& phi_n0,
+                              const WorkSlot& w_np1, const Rphis& phis,
+                              const Wphi& phi_i, const Ww& w_i) {
+    const auto grav = PhysicalConstants::g;
+    const auto f = [&] (const int p) {
+      if ( ! all && at(colmap, cm_active, p) != 0) return;
+      const int i = p / packn, s = p % packn;
+      const int c = static_cast<int>(at(colmap, cm_col, p)), gi = c / NP, gj = c % NP;
+      const auto g = [&] (const int k) {
+        const int pk = k / packn, sk = k % packn;
+        phi_i(gi,gj,pk)[sk] = (k < nlev ?
+                               phi_n0(k,i)[s] + dt2*grav*w_np1(k,i)[s] :
+                               phis(gi,gj));
+        w_i(gi,gj,pk)[sk] = w_np1(k,i)[s];
+      };
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, nlev+1), g);
+    };
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, ncol), f);
+  }
+
+  // Move the nleft unconverged columns of rows 0:nrow-1 of a to the leading
+  // positions. Since cm_src is increasing and cm_src(q) >= q, the move can be
+  // done in place by a forward sweep. Then fill positions nleft:nfill-1, the
+  // remaining lanes of the last active pack, with copies of the last active
+  // column. These lanes are never retired, but they go through the same
+  // pack-wide computations as the active ones, so they must hold valid data.
+  KOKKOS_INLINE_FUNCTION
+  static void compact_columns (const KernelVariables& kv, const int nrow,
+                               const int nleft, const int nfill,
+                               const WorkSlot& colmap, const WorkSlot& a) {
+    const auto f = [&] (const int k) {
+      const auto g = [&] () {
+        for (int q = 0; q < nleft; ++q) {
+          const int p = static_cast<int>(at(colmap, cm_src, q));
+          if (p != q) at(a, k, q) = at(a, k, p);
+        }
+        for (int q = nleft; q < nfill; ++q)
+          at(a, k, q) = at(a, k, nleft-1);
+      };
+      Kokkos::single(Kokkos::PerThread(kv.team), g);
+    };
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, nrow), f);
+  }
+
   // Determine a step length 0 < alpha <= 1.
   KOKKOS_INLINE_FUNCTION static void
   calc_step_size (const KernelVariables& kv, const int nlev, const int nvec,
@@ -794,7 +1011,9 @@ struct DirkFunctorImpl {
                   const WorkSlot& dphi_n0, const WorkSlot& w_np1, const LinearSystemSlot& x,
                   // On input, wrk(0,i)[s] is 1 if the step length should be
                   // smaller. On output, alpha is in wrk(2,:).
-                  const WorkSlot& wrk) {
+                  const WorkSlot& wrk,
+                  // Number of columns (pack lanes) to consider.
+                  const int ncol = scaln) {
     using Kokkos::parallel_reduce;
     using Kokkos::parallel_for;
     using Kokkos::TeamThreadRange;
@@ -842,7 +1061,7 @@ struct DirkFunctorImpl {
       // Step halfway to the distance at which at least one dphi is 0.
       wrk(2,i)[s] = min(1.0, alpha)/2;
     };
-    const auto tr = TeamThreadRange(kv.team, static_cast<int>(scaln));
+    const auto tr = TeamThreadRange(kv.team, ncol);
     parallel_for(tr, f);
   }
 
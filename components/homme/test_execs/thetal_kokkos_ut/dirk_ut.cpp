@@ -762,9 +762,10 @@ TEST_CASE ("dirk_toplevel_testing") {
     const int nm1 = alphadtwt_nm1 == 0.0 ? -1 : 0;
     for (Real alphadtwt_n0 : {0.0, 0.7}) {
       decltype(ElementsState::m_w_i) w_i("w_i", nelemd),
-        w_i1("w_i1", nelemd), w_i2("w_i2", nelemd);
+        w_i1("w_i1", nelemd), w_i2("w_i2", nelemd), w_i3("w_i3", nelemd);
       decltype(ElementsState::m_phinh_i) phinh_i("phinh_i", nelemd),
-        phinh_i1("phinh_i1", nelemd), phinh_i2("phinh_i2", nelemd);
+        phinh_i1("phinh_i1", nelemd), phinh_i2("phinh_i2", nelemd),
+        phinh_i3("phinh_i3", nelemd);
 
       bool good = false;
       for (int trial = 0; trial < 100 /* don't enter an inf loop */; ++trial) {
@@ -827,6 +828,18 @@ TEST_CASE ("dirk_toplevel_testing") {
         deep_copy(e.m_state.m_w_i, w_i);
         deep_copy(e.m_state.m_phinh_i, phinh_i);
 
+        // Run C++ with non-BFB solver and per-column early exit.
+        d.m_col_early_exit = true;
+        d.run(nm1, alphadtwt_nm1*dt2, n0, alphadtwt_n0*dt2, np1, dt2,
+              e, hvcoord, false /* non-BFB solver */);
+        d.m_col_early_exit = false;
+        fence();
+        deep_copy(w_i3, e.m_state.m_w_i);
+        deep_copy(phinh_i3, e.m_state.m_phinh_i);
+        // Restore state.
+        deep_copy(e.m_state.m_w_i, w_i);
+        deep_copy(e.m_state.m_phinh_i, phinh_i);
+
         break;
       }
 
@@ -836,6 +849,8 @@ TEST_CASE ("dirk_toplevel_testing") {
       const auto w2m = cmvdc(w_i2);
       const auto phinh1m = cmvdc(phinh_i1);
       const auto phinh2m = cmvdc(phinh_i2);
+      const auto w3m = cmvdc(w_i3);
+      const auto phinh3m = cmvdc(phinh_i3);
 
       // Test that running with BFB and non-BFB solvers produces similar answers.
       for (int ie = 0; ie < nelemd; ++ie)
@@ -848,6 +863,37 @@ TEST_CASE ("dirk_toplevel_testing") {
                 REQUIRE(almost_equal(p1[k], p2[k], 1e6*eps));
             }
 
+      // Test that per-column early exit produces the same answers as the
+      // standard non-BFB solve. Columns are solved independently, except that
+      // the standard solve iterates until all columns of an element converge.
+      // So the columns that converge last do the same iterations in both
+      // solves, and must match exactly (in BFB testing), while the columns
+      // retired earlier skip increments that are already below tolerance.
+      const auto same = [&] (const Real a, const Real b) {
+#ifdef HOMMEXX_BFB_TESTING
+        return a == b;
+#else
+        return std::abs(a-b)/(1 + std::abs(a)) <= 1e3*eps;
+#endif
+      };
+      for (int ie = 0; ie < nelemd; ++ie) {
+        int nsame = 0;
+        for (int i = 0; i < np; ++i)
+          for (int j = 0; j < np; ++j) {
+            bool col_same = true;
+            for (int f = 0; f < 2; ++f) {
+              Real* p1 = f == 0 ? &w1m(ie,np1,i,j,0)[0] : &phinh1m(ie,np1,i,j,0)[0];
+              Real* p3 = f == 0 ? &w3m(ie,np1,i,j,0)[0] : &phinh3m(ie,np1,i,j,0)[0];
+              for (int k = 0; k < nlev+1; ++k) {
+                REQUIRE(almost_equal(p3[k], p1[k], 1e6*eps));
+                if ( ! same(p3[k], p1[k])) col_same = false;
+              }
+            }
+            if (col_same) ++nsame;
+          }
+        REQUIRE(nsame > 0);
+      }
+
       // Run F90 with BFB solver.
       c2f(e);
       compute_stage_value_dirk_f90(nm1+1, alphadtwt_nm1*dt2, n0+1, alphadtwt_n0*dt2, np1+1, dt2);
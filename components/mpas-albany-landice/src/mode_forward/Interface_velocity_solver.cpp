@@ -17,6 +17,7 @@ distributed with this code, or at http://mpas-dev.github.io/license.html
 #include <sstream>
 #include <limits>
 #include <cassert>
+#include <cstdio>
 #include "Interface_velocity_solver.hpp"
 
 // ===================================================
@@ -84,6 +85,14 @@ std::vector<int> indexToCellIDData;
 int numBoundaryEdges;
 double radius;
 
+// The FE mesh only depends on the (static) MPAS mesh and on the masks defining the active domain.
+// We store a copy of the mask bits used to build the mesh, so that the 2D grid and the extruded
+// 3D grid are rebuilt only when the active domain changes (on any processor).
+bool meshCacheValid = false;
+bool reuseMesh = false;
+std::vector<char> meshMasks;
+std::vector<double> meshLevelsRatio;
+
 exchangeList_Type const *sendCellsList_F = 0, *recvCellsList_F = 0;
 exchangeList_Type const *sendEdgesList_F = 0, *recvEdgesList_F = 0;
 exchangeList_Type const *sendVerticesList_F = 0, *recvVerticesList_F = 0;
@@ -205,6 +214,9 @@ void velocity_solver_set_grid_data(int const* _nCells_F, int const* _nEdges_F,
     yCell_F = &yCellProjected[0];
     zCell_F = &zCellProjected[0];
   }
+
+  //the MPAS mesh changed, so the FE mesh needs to be rebuilt
+  meshCacheValid = false;
 }
 
 void velocity_solver_init_l1l2(double const* levelsRatio_F) {
@@ -358,6 +370,18 @@ void velocity_solver_compute_2d_grid(int const* _verticesMask_F, int const* _cel
   verticesMask_F = _verticesMask_F;
   dirichletCellsMask_F = _dirichletCellsMask_F;
 
+  // If the active domain did not change on any processor since the last call,
+  // the FE mesh and the ID maps computed below are still valid, and we reuse them.
+  std::vector<char> masks;
+  getMeshMasks(masks);
+  int meshChanged = (!meshCacheValid) || (masks != meshMasks);
+  MPI_Allreduce(MPI_IN_PLACE, &meshChanged, 1, MPI_INT, MPI_MAX, comm);
+  reuseMesh = !meshChanged;
+  if (reuseMesh)
+    return;
+  meshMasks.swap(masks);
+  meshCacheValid = true;
+
   MPI_Comm_size(comm, &numProcs);
   MPI_Comm_rank(comm, &me);
   std::vector<int> partialOffset(numProcs + 1), globalOffsetTriangles(
@@ -728,6 +752,13 @@ void velocity_solver_extrude_3d_grid(double const* levelsRatio_F) {
   if (isDomainEmpty)
     return;
 
+  //the 3D mesh is still valid if neither the 2D grid nor the layers changed
+  bool sameLevels = (int(meshLevelsRatio.size()) == nLayers) &&
+      std::equal(meshLevelsRatio.begin(), meshLevelsRatio.end(), levelsRatio_F);
+  if (reuseMesh && sameLevels)
+    return;
+  meshLevelsRatio.assign(levelsRatio_F, levelsRatio_F + nLayers);
+
   layersRatio.resize(nLayers);
   // !!Indexing of layers is reversed
   for (int i = 0; i < nLayers; i++)
@@ -1567,6 +1598,18 @@ void allToAll(double* field, exchangeList_Type const * sendList,
   }
 }
 
+void getMeshMasks(std::vector<char>& masks) {
+  //the mask bits used to build the FE mesh
+  masks.resize(nVertices_F + nCells_F + nCells_F * (nLayers + 1));
+  int index = 0;
+  for (int i = 0; i < nVertices_F; i++)
+    masks[index++] = (verticesMask_F[i] & dynamic_ice_bit_value) != 0;
+  for (int i = 0; i < nCells_F; i++)
+    masks[index++] = (cellsMask_F[i] & dynamic_ice_bit_value) != 0;
+  for (int i = 0; i < nCells_F * (nLayers + 1); i++)
+    masks[index++] = dirichletCellsMask_F[i] != 0;
+}
+
 int initialize_iceProblem(int nTriangles) {
   bool keep_proc = nTriangles > 0;
 
@@ -1677,6 +1720,10 @@ bool belongToTria(double const* x, double const* t, double bcoords[3], double ep
          //(similarly to what is done for temperature, defined on triangles)
        }
 
+       //we format the mesh lines into a buffer, and write it to file at once
+       std::string buffer;
+       buffer.reserve(64 * (nVertices + nTriangles + numBoundaryEdges));
+
        for (int index = 0; index < nVertices; index++) { //coordinates lines
           int iCell = vertexToFCell[index];
           //setting boundary vertices labels, 2 for dirichlet nodes, 1 otherwise
@@ -1684,7 +1731,10 @@ bool belongToTria(double const* x, double const* t, double bcoords[3], double ep
           int vertexLabel = (!isVertexBoundary[index]) ? 0 :
                             isDirichletVertex ? 3 : 1;
 
-          outfile << indexToVertexID[index] << " " << xCell_F[iCell] / unit_length << " " << yCell_F[iCell] / unit_length << " " << vertexLabel << "\n"  ;
+          appendToAsciiBuffer(buffer, indexToVertexID[index], ' ');
+          appendToAsciiBuffer(buffer, xCell_F[iCell] / unit_length, ' ');
+          appendToAsciiBuffer(buffer, yCell_F[iCell] / unit_length, ' ');
+          appendToAsciiBuffer(buffer, vertexLabel, '\n');
        }
 
        // sort triangle IDs (needed by Albany)
@@ -1693,7 +1743,11 @@ bool belongToTria(double const* x, double const* t, double bcoords[3], double ep
 
        for (int iTria = 0; iTria < nTriangles; iTria++) {//triangles lines
          int index = sortingIndex[iTria];
-         outfile << indexToTriangleID[index] << " " << verticesOnTria[0 + 3 * index] + 1 << " " << verticesOnTria[1 + 3 * index] + 1 << " " << verticesOnTria[2 + 3 * index] + 1 << " " << 1 << "\n"; // last digit can be used to specify a 'material'.  Not used by Albany LandIce, so giving dummy value
+         appendToAsciiBuffer(buffer, indexToTriangleID[index], ' ');
+         appendToAsciiBuffer(buffer, verticesOnTria[0 + 3 * index] + 1, ' ');
+         appendToAsciiBuffer(buffer, verticesOnTria[1 + 3 * index] + 1, ' ');
+         appendToAsciiBuffer(buffer, verticesOnTria[2 + 3 * index] + 1, ' ');
+         appendToAsciiBuffer(buffer, 1, '\n'); // last digit can be used to specify a 'material'.  Not used by Albany LandIce, so giving dummy value
        }
 
        // sort edges IDs (needed by Albany)
@@ -1701,9 +1755,13 @@ bool belongToTria(double const* x, double const* t, double bcoords[3], double ep
 
        for (int iEdge = 0; iEdge < numBoundaryEdges; iEdge++) { // boundary edges lines
          int index = sortingIndex[iEdge];
-         outfile <<  indexToEdgeID[index] << " " << boundaryEdges[0 + 3 * index] + 1 << " " << boundaryEdges[1 + 3 * index] + 1 << " " << boundaryEdges[2 + 3 * index] << "\n"; //last digit can be used to tell whether it's floating or not.. but let's worry about this later.
+         appendToAsciiBuffer(buffer, indexToEdgeID[index], ' ');
+         appendToAsciiBuffer(buffer, boundaryEdges[0 + 3 * index] + 1, ' ');
+         appendToAsciiBuffer(buffer, boundaryEdges[1 + 3 * index] + 1, ' ');
+         appendToAsciiBuffer(buffer, boundaryEdges[2 + 3 * index], '\n'); //last digit can be used to tell whether it's floating or not.. but let's worry about this later.
        }
 
+       outfile.write(buffer.data(), buffer.size());
        outfile.close();
        }
     else {
@@ -1800,12 +1858,15 @@ bool belongToTria(double const* x, double const* t, double bcoords[3], double ep
 
       int lElemColumnShift = (Ordering == 1) ? 1 : nTriangles;
       int elemLayerShift = (Ordering == 0) ? 1 : nLayers;
+      std::string buffer;
+      buffer.reserve(24 * nLayers * nTriangles);
       for(int il = 0; il<nLayers; ++il)
         for(int i = 0; i<nTriangles; ++i)  {//temperature values layer by layer
           int index = sortingIndex[i];
-          outfile << temperatureDataOnPrisms[index*elemLayerShift + il*lElemColumnShift]<<"\n";
+          appendToAsciiBuffer(buffer, temperatureDataOnPrisms[index*elemLayerShift + il*lElemColumnShift], '\n');
         }
 
+      outfile.write(buffer.data(), buffer.size());
       outfile.close();
     }
     else {
@@ -1816,10 +1877,13 @@ bool belongToTria(double const* x, double const* t, double bcoords[3], double ep
     outfile.open ("surface_velocity.ascii", std::ios::out | std::ios::trunc);
     if (outfile.is_open()) {
        outfile << nVertices << " " << 2 << "\n";  //number of vertices, number of components per vertex
+       std::string buffer;
+       buffer.reserve(24 * 2 * nVertices);
        for(int i = 0; i<nVertices; ++i)
-         outfile << observedVeloXData[i] << "\n";
+         appendToAsciiBuffer(buffer, observedVeloXData[i], '\n');
        for(int i = 0; i<nVertices; ++i)
-         outfile << observedVeloYData[i] << "\n";
+         appendToAsciiBuffer(buffer, observedVeloYData[i], '\n');
+       outfile.write(buffer.data(), buffer.size());
        outfile.close();
     }
     else {
@@ -1835,12 +1899,15 @@ bool belongToTria(double const* x, double const* t, double bcoords[3], double ep
        outfile << nVertices << " " << 2 << " " << 2 << "\n";  //number of vertices, number of levels, number of components per vertex
        outfile << 0.0 << "\n";
        outfile << 1.0 << "\n";  // sigma coordinates for velocity
+       std::string buffer;
+       buffer.reserve(24 * 4 * nVertices);
        for(int il=0; il<2; ++il) {
          for(int i = 0; i<nVertices; ++i)
-           outfile << observedVeloXData[i] << "\n";
+           appendToAsciiBuffer(buffer, observedVeloXData[i], '\n');
          for(int i = 0; i<nVertices; ++i)
-           outfile << observedVeloYData[i] << "\n";
+           appendToAsciiBuffer(buffer, observedVeloYData[i], '\n');
        }
+       outfile.write(buffer.data(), buffer.size());
        outfile.close();
     }
     else {
@@ -1869,7 +1936,22 @@ bool belongToTria(double const* x, double const* t, double bcoords[3], double ep
   }
 
 
-  void write_ascii_mesh_field(std::vector<double> fieldData, std::string filenamebase) {
+  // append value to buffer, formatted as an ostream with precision 15 would do, followed by separator.
+  // Formatting into a buffer and writing it at once is much faster than streaming each value to file.
+  void appendToAsciiBuffer(std::string& buffer, double value, char separator) {
+    char str[32];
+    int len = std::snprintf(str, sizeof(str), "%.15g%c", value, separator);
+    buffer.append(str, len);
+  }
+
+  void appendToAsciiBuffer(std::string& buffer, int value, char separator) {
+    char str[16];
+    int len = std::snprintf(str, sizeof(str), "%d%c", value, separator);
+    buffer.append(str, len);
+  }
+
+
+  void write_ascii_mesh_field(const std::vector<double>& fieldData, const std::string& filenamebase) {
 
     std::string filename = filenamebase+".ascii";
     std::cout << "Writing " << filename << std::endl;
@@ -1878,8 +1960,11 @@ bool belongToTria(double const* x, double const* t, double bcoords[3], double ep
     outfile.open (filename.c_str(), std::ios::out | std::ios::trunc);
     if (outfile.is_open()) {
        outfile << nVertices << "\n";  //number of vertices on first line
+       std::string buffer;
+       buffer.reserve(24 * nVertices);
        for(int i = 0; i < nVertices; ++i)
-         outfile << fieldData[i] << "\n";
+         appendToAsciiBuffer(buffer, fieldData[i], '\n');
+       outfile.write(buffer.data(), buffer.size());
        outfile.close();
     }
     else {
@@ -1888,7 +1973,7 @@ bool belongToTria(double const* x, double const* t, double bcoords[3], double ep
   }
 
 
-  void write_ascii_mesh_field_int(std::vector<int> fieldData, std::string filenamebase) {
+  void write_ascii_mesh_field_int(const std::vector<int>& fieldData, const std::string& filenamebase) {
 
     std::string filename = filenamebase+".ascii";
     std::cout << "Writing " << filename << std::endl;
@@ -1896,8 +1981,11 @@ bool belongToTria(double const* x, double const* t, double bcoords[3], double ep
     outfile.open (filename.c_str(), std::ios::out | std::ios::trunc);
     if (outfile.is_open()) {
        outfile << nVertices << "\n";  //number of vertices on first line
+       std::string buffer;
+       buffer.reserve(12 * nVertices);
        for(int i = 0; i < nVertices; ++i)
-         outfile << fieldData[i] << "\n";
+         appendToAsciiBuffer(buffer, fieldData[i], '\n');
+       outfile.write(buffer.data(), buffer.size());
        outfile.close();
     }
     else {
@@ -222,9 +222,13 @@ void import2DFieldsObservations(std::vector<std::pair<int, int> >& marineBdyExte
 
 void computeSortingIndices(std::vector<int>& sortingIndices, const std::vector<int>& vectorToSort, int numIndices);
 
-void write_ascii_mesh_field(std::vector<double> fieldData, std::string filenamebase);
+void write_ascii_mesh_field(const std::vector<double>& fieldData, const std::string& filenamebase);
 
-void write_ascii_mesh_field_int(std::vector<int> fieldData, std::string filenamebase);
+void write_ascii_mesh_field_int(const std::vector<int>& fieldData, const std::string& filenamebase);
+
+void appendToAsciiBuffer(std::string& buffer, double value, char separator);
+
+void appendToAsciiBuffer(std::string& buffer, int value, char separator);
 
 std::vector<int> extendMaskByOneLayer(int const* verticesMask_F);
 
@@ -238,6 +242,8 @@ void get_prism_velocity_on_FEdges(double* uNormal,
 
 int initialize_iceProblem(int nTriangles);
 
+void getMeshMasks(std::vector<char>& masks);
+
 void createReverseExchangeLists(exchangeList_Type& sendListReverse_F,
     exchangeList_Type& receiveListReverse_F,
     const std::vector<int>& newProcIds, const int* indexToID_F, exchangeList_Type const * recvList_F);